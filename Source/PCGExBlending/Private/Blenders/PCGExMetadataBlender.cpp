@@ -92,6 +92,16 @@ namespace PCGExBlending
 		for (int i = 0; i < Blenders.Num(); i++) { Blenders[i]->Blend(SourceAIndex, SourceBIndex, TargetIndex, Weight); }
 	}
 
+	void FMetadataBlender::BlendScope(const int32 SourceAIndex, const int32 SourceBIndex, const PCGExMT::FScope& Scope, const double Weight) const
+	{
+		for (int i = 0; i < Blenders.Num(); i++) { Blenders[i]->BlendScope(SourceAIndex, SourceBIndex, Scope, Weight); }
+	}
+
+	void FMetadataBlender::BlendScope(const int32 SourceAIndex, const int32 SourceBIndex, const PCGExMT::FScope& Scope, TArrayView<const double> Weights) const
+	{
+		for (int i = 0; i < Blenders.Num(); i++) { Blenders[i]->BlendScope(SourceAIndex, SourceBIndex, Scope, Weights); }
+	}
+
 	void FMetadataBlender::InitTrackers(TArray<PCGEx::FOpStats>& Trackers) const
 	{
 		Trackers.SetNumUninitialized(Blenders.Num());
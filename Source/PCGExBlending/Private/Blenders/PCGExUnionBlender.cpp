@@ -260,21 +260,50 @@ namespace PCGExBlending
 	{
 		if (InWeightedPoints.IsEmpty()) { return; }
 
+		const int32 NumPoints = InWeightedPoints.Num();
+
+		// Packed source values & weights, shared by all attributes of this union
+		TArray<uint8, TAlignedHeapAllocator<16>> Values;
+		TArray<double, TInlineAllocator<16>> Weights;
+		Weights.Reserve(NumPoints);
+
 		// For each attribute/property we want to blend
 		for (const TSharedPtr<FMultiSourceBlender>& MultiAttribute : Blenders)
 		{
-			PCGEx::FOpStats Tracking = MultiAttribute->MainBlender->BeginMultiBlend(WriteIndex);
+			const TSharedPtr<FProxyDataBlender>& MainBlender = MultiAttribute->MainBlender;
+			PCGEx::FOpStats Tracking = MainBlender->BeginMultiBlend(WriteIndex);
 
-			// For each point in the union, check if there is an attribute blender for that source; and if so, add it to the blend
-			for (const PCGExData::FWeightedPoint& P : InWeightedPoints)
+			if (MainBlender->SupportsRangeBlend())
 			{
-				if (const TSharedPtr<FProxyDataBlender>& Blender = MultiAttribute->SubBlenders[P.IO])
+				// Gather the values of every contributing point in union order, then fold them in a single typed loop
+				const int32 Stride = MainBlender->Operation->GetValueSize();
+				if (Values.Num() < NumPoints * Stride) { Values.SetNumUninitialized(NumPoints * Stride); }
+				Weights.Reset();
+
+				for (const PCGExData::FWeightedPoint& P : InWeightedPoints)
 				{
-					Blender->MultiBlend(P.Index, WriteIndex, P.Weight, Tracking);
+					if (const TSharedPtr<FProxyDataBlender>& Blender = MultiAttribute->SubBlenders[P.IO])
+					{
+						Blender->A->GetVoid(P.Index, Values.GetData() + Weights.Num() * Stride);
+						Weights.Add(P.Weight);
+					}
+				}
+
+				MainBlender->MultiBlendRange(WriteIndex, Values.GetData(), Weights, Tracking);
+			}
+			else
+			{
+				// For each point in the union, check if there is an attribute blender for that source; and if so, add it to the blend
+				for (const PCGExData::FWeightedPoint& P : InWeightedPoints)
+				{
+					if (const TSharedPtr<FProxyDataBlender>& Blender = MultiAttribute->SubBlenders[P.IO])
+					{
+						Blender->MultiBlend(P.Index, WriteIndex, P.Weight, Tracking);
+					}
 				}
 			}
 
-			MultiAttribute->MainBlender->EndMultiBlend(WriteIndex, Tracking);
+			MainBlender->EndMultiBlend(WriteIndex, Tracking);
 		}
 	}
 
@@ -118,7 +118,9 @@ namespace PCGExBlending
 	// Explicit instantiation of blend function getters
 #define INST_BLEND_FUNC_GETTER(TYPE) \
 	template FBlendFn BlendFunctions::GetBlendFunction<TYPE>(EPCGExABBlendingType); \
-	template FFinalizeFn BlendFunctions::GetFinalizeFunction<TYPE>(EPCGExABBlendingType);
+	template FFinalizeFn BlendFunctions::GetFinalizeFunction<TYPE>(EPCGExABBlendingType); \
+	template FBlendRangeFn BlendFunctions::GetBlendRangeFunction<TYPE>(EPCGExABBlendingType); \
+	template FAccumulateRangeFn BlendFunctions::GetAccumulateRangeFunction<TYPE>(EPCGExABBlendingType);
 
 	INST_BLEND_FUNC_GETTER(bool)
 	INST_BLEND_FUNC_GETTER(int32)
@@ -17,6 +17,9 @@
 
 namespace PCGExBlending
 {
+	// Number of values blended per batch chunk; keeps scratch buffers small and cache-resident
+	static constexpr int32 RangeChunkSize = 256;
+
 	// FDummyUnionBlender implementation
 
 	void FDummyUnionBlender::Init(const TSharedPtr<PCGExData::FFacade>& TargetData, const TArray<TSharedRef<PCGExData::FFacade>>& InSources)
@@ -58,6 +61,11 @@ namespace PCGExBlending
 	void FProxyDataBlender::BlendScope(const PCGExMT::FScope& Scope, const double Weight) const
 	{
 		if (!Operation || !A || !C) { return; }
+		if (SupportsRangeBlend())
+		{
+			BlendScopeRange(Scope, nullptr, nullptr, Weight);
+			return;
+		}
 
 		// Use FScopedTypedValue for safe working buffers
 		PCGExTypes::FScopedTypedValue ValA(UnderlyingType);
@@ -77,6 +85,11 @@ namespace PCGExBlending
 	void FProxyDataBlender::BlendScope(const PCGExMT::FScope& Scope, TArrayView<const double> Weights) const
 	{
 		if (!Operation || !A || !C) { return; }
+		if (SupportsRangeBlend())
+		{
+			BlendScopeRange(Scope, nullptr, Weights.GetData(), 0);
+			return;
+		}
 
 		// Use FScopedTypedValue for safe working buffers
 		PCGExTypes::FScopedTypedValue ValA(UnderlyingType);
@@ -96,6 +109,11 @@ namespace PCGExBlending
 	void FProxyDataBlender::BlendScope(const PCGExMT::FScope& Scope, TArrayView<const int8> Mask, const double Weight) const
 	{
 		if (!Operation || !A || !C) { return; }
+		if (SupportsRangeBlend())
+		{
+			BlendScopeRange(Scope, Mask.GetData(), nullptr, Weight);
+			return;
+		}
 
 		// Use FScopedTypedValue for safe working buffers
 		PCGExTypes::FScopedTypedValue ValA(UnderlyingType);
@@ -117,6 +135,11 @@ namespace PCGExBlending
 	void FProxyDataBlender::BlendScope(const PCGExMT::FScope& Scope, TArrayView<const int8> Mask, TArrayView<const double> Weights) const
 	{
 		if (!Operation || !A || !C) { return; }
+		if (SupportsRangeBlend())
+		{
+			BlendScopeRange(Scope, Mask.GetData(), Weights.GetData(), 0);
+			return;
+		}
 
 		// Use FScopedTypedValue for safe working buffers
 		PCGExTypes::FScopedTypedValue ValA(UnderlyingType);
@@ -136,6 +159,96 @@ namespace PCGExBlending
 		}
 	}
 
+	void FProxyDataBlender::BlendScope(const int32 SourceIndexA, const int32 SourceIndexB, const PCGExMT::FScope& Scope, const double Weight) const
+	{
+		BlendScopeBroadcast(SourceIndexA, SourceIndexB, Scope, nullptr, Weight);
+	}
+
+	void FProxyDataBlender::BlendScope(const int32 SourceIndexA, const int32 SourceIndexB, const PCGExMT::FScope& Scope, TArrayView<const double> Weights) const
+	{
+		BlendScopeBroadcast(SourceIndexA, SourceIndexB, Scope, Weights.GetData(), 0);
+	}
+
+	bool FProxyDataBlender::SupportsRangeBlend() const
+	{
+		return Operation && !Operation->NeedsLifecycleManagement();
+	}
+
+	void FProxyDataBlender::BlendScopeRange(const PCGExMT::FScope& Scope, const int8* Mask, const double* Weights, const double Weight) const
+	{
+		const int32 Stride = Operation->GetValueSize();
+		const int32 ChunkSize = FMath::Min(RangeChunkSize, Scope.Count);
+
+		TArray<uint8, TAlignedHeapAllocator<16>> Scratch;
+		Scratch.SetNumUninitialized(ChunkSize * Stride * 3);
+
+		uint8* ValA = Scratch.GetData();
+		uint8* ValB = ValA + ChunkSize * Stride;
+		uint8* ValC = ValB + ChunkSize * Stride;
+
+		for (int32 Offset = 0; Offset < Scope.Count; Offset += ChunkSize)
+		{
+			const int32 Start = Scope.Start + Offset;
+			const int32 Count = FMath::Min(ChunkSize, Scope.Count - Offset);
+
+			A->GetVoidRange(Start, Count, ValA);
+			B->GetVoidRange(Start, Count, ValB);
+
+			if (Weights) { Operation->BlendRange(ValA, ValB, TConstArrayView<double>(Weights + Offset, Count), ValC); }
+			else { Operation->BlendRange(ValA, ValB, Weight, ValC, Count); }
+
+			if (!Mask)
+			{
+				C->SetVoidRange(Start, Count, ValC);
+				continue;
+			}
+
+			// Masked-out entries were blended too, but are never written back
+			for (int32 i = 0; i < Count; i++) { if (Mask[Offset + i]) { C->SetVoid(Start + i, ValC + i * Stride); } }
+		}
+	}
+
+	void FProxyDataBlender::BlendScopeBroadcast(const int32 SourceIndexA, const int32 SourceIndexB, const PCGExMT::FScope& Scope, const double* Weights, const double Weight) const
+	{
+		if (!Operation || !A || !C || Scope.Count <= 0) { return; }
+
+		// Sources living inside the written range may be overwritten mid-scope; keep sequential read-after-write order then
+		const bool bSourcesInScope = (SourceIndexA >= Scope.Start && SourceIndexA < Scope.End) || (SourceIndexB >= Scope.Start && SourceIndexB < Scope.End);
+
+		if (bSourcesInScope || !SupportsRangeBlend())
+		{
+			PCGEX_SCOPE_LOOP(Index) { Blend(SourceIndexA, SourceIndexB, Index, Weights ? Weights[Index - Scope.Start] : Weight); }
+			return;
+		}
+
+		const int32 Stride = Operation->GetValueSize();
+		const int32 ChunkSize = FMath::Min(RangeChunkSize, Scope.Count);
+
+		TArray<uint8, TAlignedHeapAllocator<16>> Scratch;
+		Scratch.SetNumUninitialized(ChunkSize * Stride * 3);
+
+		uint8* ValA = Scratch.GetData();
+		uint8* ValB = ValA + ChunkSize * Stride;
+		uint8* ValC = ValB + ChunkSize * Stride;
+
+		// Sources are constant over the scope, read them once and splat them across the chunk
+		A->GetVoid(SourceIndexA, ValA);
+		B->GetVoid(SourceIndexB, ValB);
+		for (int32 i = 1; i < ChunkSize; i++)
+		{
+			FMemory::Memcpy(ValA + i * Stride, ValA, Stride);
+			FMemory::Memcpy(ValB + i * Stride, ValB, Stride);
+		}
+
+		for (int32 Offset = 0; Offset < Scope.Count; Offset += ChunkSize)
+		{
+			const int32 Count = FMath::Min(ChunkSize, Scope.Count - Offset);
+			if (Weights) { Operation->BlendRange(ValA, ValB, TConstArrayView<double>(Weights + Offset, Count), ValC); }
+			else { Operation->BlendRange(ValA, ValB, Weight, ValC, Count); }
+			C->SetVoidRange(Scope.Start + Offset, Count, ValC);
+		}
+	}
+
 	PCGEx::FOpStats FProxyDataBlender::BeginMultiBlend(const int32 TargetIndex)
 	{
 		PCGEx::FOpStats Tracker{};
@@ -181,6 +294,38 @@ namespace PCGExBlending
 		Tracker.TotalWeight += Weight;
 	}
 
+	void FProxyDataBlender::MultiBlendRange(const int32 TargetIndex, const void* Sources, TConstArrayView<double> Weights, PCGEx::FOpStats& Tracker)
+	{
+		check(Operation)
+		check(C)
+
+		if (Weights.IsEmpty()) { return; }
+
+		const int32 Stride = Operation->GetValueSize();
+		const uint8* InSources = static_cast<const uint8*>(Sources);
+
+		PCGExTypes::FScopedTypedValue Current(UnderlyingType);
+
+		int32 First = 0;
+		if (Tracker.Count < 0)
+		{
+			// First source is copied as-is, matching MultiBlend
+			Tracker.Count = 0;
+			FMemory::Memcpy(Current.GetRaw(), InSources, Stride);
+			First = 1;
+		}
+		else
+		{
+			C->GetCurrentVoid(TargetIndex, Current.GetRaw());
+		}
+
+		Operation->AccumulateRange(InSources + First * Stride, Current.GetRaw(), Weights.RightChop(First));
+		C->SetVoid(TargetIndex, Current.GetRaw());
+
+		Tracker.Count += Weights.Num();
+		for (const double W : Weights) { Tracker.TotalWeight += W; }
+	}
+
 	void FProxyDataBlender::EndMultiBlend(const int32 TargetIndex, PCGEx::FOpStats& Tracker)
 	{
 		check(Operation)
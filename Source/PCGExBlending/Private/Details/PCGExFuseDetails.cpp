@@ -113,6 +113,12 @@ bool FPCGExFuseDetails::Init(FPCGExContext* InContext, const TSharedPtr<PCGExDat
 	return true;
 }
 
+bool FPCGExFuseDetails::SupportsConcurrentHash() const
+{
+	if (bSupportLocalTolerance && ToleranceInput != EPCGExInputValueType::Constant) { return false; }
+	return SourceDistance == EPCGExDistance::Center && TargetDistance == EPCGExDistance::Center;
+}
+
 uint64 FPCGExFuseDetails::GetGridKey(const FVector& Location, const int32 PointIndex) const
 {
 	return PCGEx::SH3(Location + VoxelGridOffset, PCGEx::SafeTolerance(ToleranceGetter->Read(PointIndex)));
@@ -10,14 +10,7 @@
 
 void FPCGExSubPointsBlendInheritEnd::BlendSubPoints(const PCGExData::FConstPoint& From, const PCGExData::FConstPoint& To, PCGExData::FScope& Scope, const PCGExPaths::FPathMetrics& Metrics) const
 {
-	TPCGValueRange<FTransform> OutTransform = Scope.Data->GetTransformValueRange(false);
-
-	PCGEX_SCOPE_LOOP(Index)
-	{
-		//FVector Location = OutTransform[Index].GetLocation();
-		MetadataBlender->Blend(From.Index, To.Index, Index, 1);
-		//OutTransform[Index].SetLocation(Location);
-	}
+	MetadataBlender->BlendScope(From.Index, To.Index, Scope, 1);
 }
 
 TSharedPtr<FPCGExSubPointsBlendOperation> UPCGExSubPointsBlendInheritEnd::CreateOperation() const
@@ -40,6 +40,10 @@ namespace PCGExBlending
 		virtual void Blend(const int32 SourceIndex, const int32 TargetIndex, const double Weight) const override;
 		virtual void Blend(const int32 SourceAIndex, const int32 SourceBIndex, const int32 TargetIndex, const double Weight) const override;
 
+		// Scope = SourceA|SourceB, one weight per scope entry. Goes through the batch range path when possible.
+		void BlendScope(const int32 SourceAIndex, const int32 SourceBIndex, const PCGExMT::FScope& Scope, const double Weight) const;
+		void BlendScope(const int32 SourceAIndex, const int32 SourceBIndex, const PCGExMT::FScope& Scope, TArrayView<const double> Weights) const;
+
 		virtual void InitTrackers(TArray<PCGEx::FOpStats>& Trackers) const override;
 
 		virtual void BeginMultiBlend(const int32 TargetIndex, TArray<PCGEx::FOpStats>& Trackers) const override;
@@ -27,6 +27,12 @@ namespace PCGExBlending
 	// Finalize: Acc = Finalize(Acc, TotalWeight, Count)
 	using FFinalizeFn = void (*)(void* Accumulator, double TotalWeight, int32 Count);
 
+	// Range blend: Out[i] = Blend(A[i], B[i], Weights ? Weights[i] : Weight), over tightly packed values
+	using FBlendRangeFn = void (*)(const void* A, const void* B, const double* Weights, double Weight, void* Out, int32 Count);
+
+	// Range accumulate: Acc = Accumulate(Acc, Sources[i], Weights ? Weights[i] : Weight), folding tightly packed values into one accumulator
+	using FAccumulateRangeFn = void (*)(void* Accumulator, const void* Sources, const double* Weights, double Weight, int32 Count);
+
 	//
 	// IBlendOperation - Type-erased interface for blend operations
 	//
@@ -45,6 +51,9 @@ namespace PCGExBlending
 		FBlendFn AccumulateFunc = nullptr;
 		FFinalizeFn FinalizeFunc = nullptr;
 
+		FBlendRangeFn BlendRangeFunc = nullptr;
+		FAccumulateRangeFn AccumulateRangeFunc = nullptr;
+
 	public:
 		IBlendOperation(EPCGExABBlendingType InMode, bool bInResetForMulti);
 		virtual ~IBlendOperation() = default;
@@ -52,6 +61,10 @@ namespace PCGExBlending
 		// Core blend: Out = Blend(A, B, Weight)
 		FORCEINLINE void Blend(const void* A, const void* B, double Weight, void* Out) const { BlendFunc(A, B, Weight, Out); }
 
+		// Range blend over tightly packed working-type values: Out[i] = Blend(A[i], B[i], Weight)
+		FORCEINLINE void BlendRange(const void* A, const void* B, const double Weight, void* Out, const int32 Count) const { BlendRangeFunc(A, B, nullptr, Weight, Out, Count); }
+		FORCEINLINE void BlendRange(const void* A, const void* B, const TConstArrayView<double> Weights, void* Out) const { BlendRangeFunc(A, B, Weights.GetData(), 0, Out, Weights.Num()); }
+
 		// Multi-blend operations for accumulation patterns
 		FORCEINLINE void BeginMulti(void* Accumulator, const void* InitialValue, PCGEx::FOpStats& OutTracker) const
 		{
@@ -79,6 +92,11 @@ namespace PCGExBlending
 		}
 
 		FORCEINLINE void Accumulate(const void* Source, void* Accumulator, double Weight) const { AccumulateFunc(Accumulator, Source, Weight, Accumulator); }
+
+		// Range accumulate over tightly packed working-type sources, in order, into a single accumulator
+		FORCEINLINE void AccumulateRange(const void* Sources, void* Accumulator, const double Weight, const int32 Count) const { AccumulateRangeFunc(Accumulator, Sources, nullptr, Weight, Count); }
+		FORCEINLINE void AccumulateRange(const void* Sources, void* Accumulator, const TConstArrayView<double> Weights) const { AccumulateRangeFunc(Accumulator, Sources, Weights.GetData(), 0, Weights.Num()); }
+
 		FORCEINLINE void EndMulti(void* Accumulator, double TotalWeight, int32 Count) const { FinalizeFunc(Accumulator, TotalWeight, Count); }
 
 		// Division helper (for external averaging)
@@ -295,6 +313,105 @@ namespace PCGExBlending
 			}
 		}
 
+		// Range kernels
+		// The per-value function is a template argument so it inlines into a typed loop the compiler can vectorize,
+		// instead of paying an indirect call per value. Out may alias A, never B.
+
+		template <typename T, FBlendFn Fn>
+		void BlendRange(const void* A, const void* B, const double* Weights, const double Weight, void* Out, const int32 Count)
+		{
+			const T* InA = static_cast<const T*>(A);
+			const T* InB = static_cast<const T*>(B);
+			T* OutValues = static_cast<T*>(Out);
+
+			if (Weights) { for (int32 i = 0; i < Count; i++) { Fn(InA + i, InB + i, Weights[i], OutValues + i); } }
+			else { for (int32 i = 0; i < Count; i++) { Fn(InA + i, InB + i, Weight, OutValues + i); } }
+		}
+
+		// Get range blend function pointer by mode
+		template <typename T>
+		FBlendRangeFn GetBlendRangeFunction(const EPCGExABBlendingType Mode)
+		{
+			switch (Mode)
+			{
+			case EPCGExABBlendingType::Add: return &BlendRange<T, &Add<T>>;
+			case EPCGExABBlendingType::Subtract: return &BlendRange<T, &Sub<T>>;
+			case EPCGExABBlendingType::Multiply: return &BlendRange<T, &Mult<T>>;
+			case EPCGExABBlendingType::Divide: return &BlendRange<T, &Divide<T>>;
+			case EPCGExABBlendingType::Lerp: return &BlendRange<T, &Lerp<T>>;
+			case EPCGExABBlendingType::Min: return &BlendRange<T, &Min<T>>;
+			case EPCGExABBlendingType::Max: return &BlendRange<T, &Max<T>>;
+			case EPCGExABBlendingType::Average: return &BlendRange<T, &Average<T>>;
+			case EPCGExABBlendingType::Weight: return &BlendRange<T, &Weight<T>>;
+			case EPCGExABBlendingType::WeightedAdd: return &BlendRange<T, &WeightedAdd<T>>;
+			case EPCGExABBlendingType::WeightedSubtract: return &BlendRange<T, &WeightedSub<T>>;
+			case EPCGExABBlendingType::CopyTarget: return &BlendRange<T, &CopyA<T>>;
+			case EPCGExABBlendingType::CopySource: return &BlendRange<T, &CopyB<T>>;
+			case EPCGExABBlendingType::UnsignedMin: return &BlendRange<T, &UnsignedMin<T>>;
+			case EPCGExABBlendingType::UnsignedMax: return &BlendRange<T, &UnsignedMax<T>>;
+			case EPCGExABBlendingType::AbsoluteMin: return &BlendRange<T, &AbsoluteMin<T>>;
+			case EPCGExABBlendingType::AbsoluteMax: return &BlendRange<T, &AbsoluteMax<T>>;
+			case EPCGExABBlendingType::Hash: return &BlendRange<T, &NaiveHash<T>>;
+			case EPCGExABBlendingType::UnsignedHash: return &BlendRange<T, &UnsignedHash<T>>;
+			case EPCGExABBlendingType::Mod: return &BlendRange<T, &ModSimple<T>>;
+			case EPCGExABBlendingType::ModCW: return &BlendRange<T, &ModComplex<T>>;
+			case EPCGExABBlendingType::WeightNormalize:
+			case EPCGExABBlendingType::GeometricMean:
+			case EPCGExABBlendingType::HarmonicMean:
+			case EPCGExABBlendingType::RMS:
+			case EPCGExABBlendingType::Step: return &BlendRange<T, &Weight<T>>; // TBD, mirrors GetBlendFunction
+			case EPCGExABBlendingType::None:
+			default: return &BlendRange<T, &None<T>>;
+			}
+		}
+
+		template <typename T, FBlendFn Fn>
+		void AccumulateRange(void* Accumulator, const void* Sources, const double* Weights, const double Weight, const int32 Count)
+		{
+			T* Acc = static_cast<T*>(Accumulator);
+			const T* InSources = static_cast<const T*>(Sources);
+
+			if (Weights) { for (int32 i = 0; i < Count; i++) { Fn(Acc, InSources + i, Weights[i], Acc); } }
+			else { for (int32 i = 0; i < Count; i++) { Fn(Acc, InSources + i, Weight, Acc); } }
+		}
+
+		// Get range accumulate function pointer by mode, mirrors GetAccumulateFunction
+		template <typename T>
+		FAccumulateRangeFn GetAccumulateRangeFunction(const EPCGExABBlendingType Mode)
+		{
+			switch (Mode)
+			{
+			case EPCGExABBlendingType::Add: return &AccumulateRange<T, &Add<T>>;
+			case EPCGExABBlendingType::Subtract: return &AccumulateRange<T, &Sub<T>>;
+			case EPCGExABBlendingType::Multiply: return &AccumulateRange<T, &Mult<T>>;
+			case EPCGExABBlendingType::Divide: return &AccumulateRange<T, &Divide<T>>;
+			case EPCGExABBlendingType::Lerp: return &AccumulateRange<T, &Lerp<T>>;
+			case EPCGExABBlendingType::Min: return &AccumulateRange<T, &Min<T>>;
+			case EPCGExABBlendingType::Max: return &AccumulateRange<T, &Max<T>>;
+			case EPCGExABBlendingType::Average: return &AccumulateRange<T, &Add<T>>; // Same as GetAccumulateFunction, averaging happens in EndMulti
+			case EPCGExABBlendingType::Weight: return &AccumulateRange<T, &Weight<T>>;
+			case EPCGExABBlendingType::WeightedAdd: return &AccumulateRange<T, &WeightedAdd<T>>;
+			case EPCGExABBlendingType::WeightedSubtract: return &AccumulateRange<T, &WeightedSub<T>>;
+			case EPCGExABBlendingType::CopyTarget: return &AccumulateRange<T, &CopyA<T>>;
+			case EPCGExABBlendingType::CopySource: return &AccumulateRange<T, &CopyB<T>>;
+			case EPCGExABBlendingType::UnsignedMin: return &AccumulateRange<T, &UnsignedMin<T>>;
+			case EPCGExABBlendingType::UnsignedMax: return &AccumulateRange<T, &UnsignedMax<T>>;
+			case EPCGExABBlendingType::AbsoluteMin: return &AccumulateRange<T, &AbsoluteMin<T>>;
+			case EPCGExABBlendingType::AbsoluteMax: return &AccumulateRange<T, &AbsoluteMax<T>>;
+			case EPCGExABBlendingType::Hash: return &AccumulateRange<T, &NaiveHash<T>>;
+			case EPCGExABBlendingType::UnsignedHash: return &AccumulateRange<T, &UnsignedHash<T>>;
+			case EPCGExABBlendingType::Mod: return &AccumulateRange<T, &ModSimple<T>>;
+			case EPCGExABBlendingType::ModCW: return &AccumulateRange<T, &ModComplex<T>>;
+			case EPCGExABBlendingType::WeightNormalize:
+			case EPCGExABBlendingType::GeometricMean:
+			case EPCGExABBlendingType::HarmonicMean:
+			case EPCGExABBlendingType::RMS:
+			case EPCGExABBlendingType::Step: return &AccumulateRange<T, &Weight<T>>; // TBD, mirrors GetBlendFunction
+			case EPCGExABBlendingType::None:
+			default: return &AccumulateRange<T, &None<T>>;
+			}
+		}
+
 		// Finalize functions for multi-blend
 
 		template <typename T>
@@ -372,6 +489,8 @@ namespace PCGExBlending
 			BlendFunc = BlendFunctions::GetBlendFunction<T>(InMode);
 			AccumulateFunc = BlendFunctions::GetAccumulateFunction<T>(InMode);
 			FinalizeFunc = BlendFunctions::GetFinalizeFunction<T>(InMode);
+			BlendRangeFunc = BlendFunctions::GetBlendRangeFunction<T>(InMode);
+			AccumulateRangeFunc = BlendFunctions::GetAccumulateRangeFunction<T>(InMode);
 		}
 
 		//~ Begin IBlendOperation interface
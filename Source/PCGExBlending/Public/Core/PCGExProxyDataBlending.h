@@ -219,9 +219,20 @@ namespace PCGExBlending
 		void BlendScope(const PCGExMT::FScope& Scope, TArrayView<const int8> Mask, const double Weight) const;
 		void BlendScope(const PCGExMT::FScope& Scope, TArrayView<const int8> Mask, TArrayView<const double> Weights) const;
 
+		// Range = SourceA|SourceB, broadcasting the same two sources over the whole scope
+		void BlendScope(const int32 SourceIndexA, const int32 SourceIndexB, const PCGExMT::FScope& Scope, const double Weight) const;
+		void BlendScope(const int32 SourceIndexA, const int32 SourceIndexB, const PCGExMT::FScope& Scope, TArrayView<const double> Weights) const;
+
+		// Whether scope blending can go through the batch range path (trivially copyable working type)
+		bool SupportsRangeBlend() const;
+
 		// Multi-blend operations
 		PCGEx::FOpStats BeginMultiBlend(const int32 TargetIndex);
 		void MultiBlend(const int32 SourceIndex, const int32 TargetIndex, const double Weight, PCGEx::FOpStats& Tracker);
+
+		// Same as calling MultiBlend once per source, in order, but folds tightly packed working-type Sources
+		// into a single accumulator and only reads/writes the target once. Requires SupportsRangeBlend().
+		void MultiBlendRange(const int32 TargetIndex, const void* Sources, TConstArrayView<double> Weights, PCGEx::FOpStats& Tracker);
 		void EndMultiBlend(const int32 TargetIndex, PCGEx::FOpStats& Tracker);
 
 		// Division helper
@@ -246,6 +257,11 @@ namespace PCGExBlending
 	protected:
 		// Cached type info
 		bool bNeedsLifecycleManagement = false;
+
+		// Batch path : bulk-read A & B into packed chunks, blend the chunk in one typed loop, write back.
+		// Mask and Weights are relative to Scope.Start and may be null.
+		void BlendScopeRange(const PCGExMT::FScope& Scope, const int8* Mask, const double* Weights, const double Weight) const;
+		void BlendScopeBroadcast(const int32 SourceIndexA, const int32 SourceIndexB, const PCGExMT::FScope& Scope, const double* Weights, const double Weight) const;
 	};
 
 	//
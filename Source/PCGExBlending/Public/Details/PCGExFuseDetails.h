@@ -119,6 +119,9 @@ struct PCGEXBLENDING_API FPCGExFuseDetails : public FPCGExSourceFuseDetails
 
 	bool DoInlineInsertion() const { return bInlineInsertion; }
 
+	/** Whether the concurrent spatial hash can stand in for the octree, i.e fixed tolerance and center-to-center distances */
+	bool SupportsConcurrentHash() const;
+
 	uint64 GetGridKey(const FVector& Location, const int32 PointIndex) const;
 	FBox GetOctreeBox(const FVector& Location, const int32 PointIndex) const;
 
@@ -11,6 +11,7 @@ enum class EPCGExFuseMethod : uint8
 {
 	Voxel  = 0 UMETA(DisplayName = "Spatial Hash", Tooltip="Fast but blocky. Creates grid-looking approximation."),
 	Octree = 1 UMETA(DisplayName = "Octree", Tooltip="Slow but precise. Respectful of the original topology. Requires stable insertion with large values."),
+	Concurrent = 2 UMETA(DisplayName = "Concurrent", Tooltip="Precise like Octree, but backed by a sharded spatial hash so insertion scales with cores. Requires constant tolerance & center distances, falls back to Octree otherwise."),
 };
 
 namespace PCGExGraphs::States
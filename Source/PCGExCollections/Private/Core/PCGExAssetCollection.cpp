@@ -98,15 +98,7 @@ namespace PCGExAssetCollection
 
 	int32 FMicroCache::GetPickRandomWeighted(int32 Seed) const
 	{
-		if (Order.IsEmpty())
-		{
-			return -1;
-		}
-
-		const int32 Threshold = FRandomStream(Seed).RandRange(0, static_cast<int32>(WeightSum) - 1);
-		int32 Pick = 0;
-		while (Pick < Weights.Num() && Weights[Pick] < Threshold) { Pick++; }
-		return Order[FMath::Min(Pick, Order.Num() - 1)];
+		return AliasTable.Pick(Seed);
 	}
 
 	void FMicroCache::BuildFromWeights(TConstArrayView<int32> InWeights)
@@ -119,6 +111,8 @@ namespace PCGExAssetCollection
 			Weights[i] = InWeights[i] + 1; // +1 to ensure non-zero
 		}
 
+		AliasTable.Build(Weights);
+
 		PCGExArrayHelpers::ArrayOfIndices(Order, NumEntries);
 
 		Order.Sort([this](int32 A, int32 B) { return Weights[A] < Weights[B]; });
@@ -177,10 +171,7 @@ namespace PCGExAssetCollection
 	int32 FCategory::GetPickRandomWeighted(int32 Seed) const
 	{
 		if (Order.IsEmpty()) { return -1; }
-		const int32 Threshold = FRandomStream(Seed).RandRange(0, static_cast<int32>(WeightSum) - 1);
-		int32 Pick = 0;
-		while (Pick < Weights.Num() && Weights[Pick] < Threshold) { Pick++; }
-		return Indices[Order[FMath::Min(Pick, Order.Num() - 1)]];
+		return Indices[AliasTable.Pick(Seed)];
 	}
 
 	void FCategory::Reserve(int32 InNum)
@@ -210,6 +201,8 @@ namespace PCGExAssetCollection
 		Shrink();
 
 		const int32 NumEntries = Indices.Num();
+		AliasTable.Build(Weights);
+
 		PCGExArrayHelpers::ArrayOfIndices(Order, NumEntries);
 
 		Order.Sort([this](int32 A, int32 B) { return Weights[A] < Weights[B]; });
@@ -453,6 +446,32 @@ FPCGExEntryAccessResult UPCGExAssetCollection::GetEntryWeightedRandom(int32 Seed
 	return Result;
 }
 
+void UPCGExAssetCollection::GetEntriesWeightedRandom(TConstArrayView<int32> Seeds, TArrayView<FPCGExEntryAccessResult> OutResults) const
+{
+	check(Seeds.Num() == OutResults.Num());
+
+	// Resolve the cache once for the whole batch
+	const PCGExAssetCollection::FCategory* Main = const_cast<UPCGExAssetCollection*>(this)->LoadCache()->Main.Get();
+
+	for (int32 i = 0; i < Seeds.Num(); i++)
+	{
+		FPCGExEntryAccessResult& Result = OutResults[i];
+		Result = FPCGExEntryAccessResult{};
+
+		const FPCGExAssetCollectionEntry* Entry = GetEntryAtRawIndex(Main->GetPickRandomWeighted(Seeds[i]));
+		if (!Entry) { continue; }
+
+		if (Entry->HasValidSubCollection())
+		{
+			Result = Entry->GetSubCollectionPtr()->GetEntryWeightedRandom(Seeds[i] * 2);
+			continue;
+		}
+
+		Result.Entry = Entry;
+		Result.Host = this;
+	}
+}
+
 // With tag inheritance
 
 FPCGExEntryAccessResult UPCGExAssetCollection::GetEntryAt(int32 Index, uint8 TagInheritance, TSet<FName>& OutTags) const
@@ -408,6 +408,23 @@ namespace PCGExAssetStaging
 		const bool bFilterEntryType = Settings->bDoFilterEntryType;
 		const FPCGExStagedTypeFilterDetails& EntryTypeFilter = Settings->EntryTypeFilter;
 
+		// With a single collection, every point shares the same helper and entries can be picked for the whole scope at once
+		TArray<int32> ScopeSeeds;
+		TArray<FPCGExEntryAccessResult> ScopeResults;
+
+		PCGExCollections::FDistributionHelper* SharedHelper = nullptr;
+		PCGExCollections::FMicroDistributionHelper* SharedMicroHelper = nullptr;
+
+		if (Source->IsSingleSource() && Source->TryGetHelpers(Scope.Start, SharedHelper, SharedMicroHelper) && SharedHelper)
+		{
+			ScopeSeeds.SetNumUninitialized(Scope.Count);
+			PCGEX_SCOPE_LOOP(Index) { ScopeSeeds[Index - Scope.Start] = PCGExRandomHelpers::GetSeed(Seeds[Index], SharedHelper->Details.SeedComponents, SharedHelper->Details.LocalSeed, Settings, Component); }
+
+			SharedHelper->GetEntries(Scope, ScopeSeeds, ScopeResults);
+		}
+
+		const bool bBatchedPicks = !ScopeResults.IsEmpty();
+
 		PCGEX_SCOPE_LOOP(Index)
 		{
 			PCGExCollections::FDistributionHelper* Helper = nullptr;
@@ -419,9 +436,9 @@ namespace PCGExAssetStaging
 				continue;
 			}
 
-			const int32 Seed = PCGExRandomHelpers::GetSeed(Seeds[Index], Helper->Details.SeedComponents, Helper->Details.LocalSeed, Settings, Component);
+			const int32 Seed = bBatchedPicks ? ScopeSeeds[Index - Scope.Start] : PCGExRandomHelpers::GetSeed(Seeds[Index], Helper->Details.SeedComponents, Helper->Details.LocalSeed, Settings, Component);
 
-			FPCGExEntryAccessResult Result = Helper->GetEntry(Index, Seed);
+			FPCGExEntryAccessResult Result = bBatchedPicks ? ScopeResults[Index - Scope.Start] : Helper->GetEntry(Index, Seed);
 
 			if (!Result.IsValid()
 				|| !Result.Entry->Staging.Bounds.IsValid
@@ -6,6 +6,7 @@
 
 #include "PCGParamData.h"
 #include "Core/PCGExAssetCollection.h"
+#include "Core/PCGExMTCommon.h"
 #include "Data/PCGExData.h"
 #include "Data/PCGExPointIO.h"
 #include "Details/PCGExSettingsDetails.h"
@@ -174,6 +175,22 @@ namespace PCGExCollections
 		return FPCGExEntryAccessResult{};
 	}
 
+	void FDistributionHelper::GetEntries(const PCGExMT::FScope& Scope, TConstArrayView<int32> Seeds, TArray<FPCGExEntryAccessResult>& OutResults) const
+	{
+		check(Seeds.Num() == Scope.Count);
+
+		OutResults.SetNum(Scope.Count);
+
+		// Weighted picks without categories don't depend on point data, let the collection batch them
+		if (!CategoryGetter && Details.Distribution == EPCGExDistribution::WeightedRandom)
+		{
+			Collection->GetEntriesWeightedRandom(Seeds, OutResults);
+			return;
+		}
+
+		PCGEX_SCOPE_LOOP(Index) { OutResults[Index - Scope.Start] = GetEntry(Index, Seeds[Index - Scope.Start]); }
+	}
+
 	// MicroDistribution Helper Implementation
 
 	FMicroDistributionHelper::FMicroDistributionHelper(const FPCGExMicroCacheDistributionDetails& InDetails)
@@ -13,6 +13,7 @@
 #include "Details/PCGExStagingDetails.h"
 #include "Fitting/PCGExFittingVariations.h"
 #include "Helpers/PCGExStreamingHelpers.h"
+#include "Math/PCGExAliasTable.h"
 
 #include "PCGExAssetCollection.generated.h"
 
@@ -218,6 +219,7 @@ namespace PCGExAssetCollection
 		double WeightSum = 0;
 		TArray<int32> Weights;
 		TArray<int32> Order;
+		PCGExMath::FAliasTable AliasTable;
 
 	public:
 		FMicroCache() = default;
@@ -253,6 +255,7 @@ namespace PCGExAssetCollection
 		TArray<int32> Weights;
 		TArray<int32> Order;
 		TArray<const FPCGExAssetCollectionEntry*> Entries;
+		PCGExMath::FAliasTable AliasTable;
 
 		FCategory() = default;
 
@@ -348,6 +351,9 @@ public:
 	/** Get random entry (weighted by entry Weight property) */
 	FPCGExEntryAccessResult GetEntryWeightedRandom(int32 Seed) const;
 
+	/** Batched GetEntryWeightedRandom, OutResults must be the same size as Seeds */
+	void GetEntriesWeightedRandom(TConstArrayView<int32> Seeds, TArrayView<FPCGExEntryAccessResult> OutResults) const;
+
 	// With tag inheritance
 	FPCGExEntryAccessResult GetEntryAt(int32 Index, uint8 TagInheritance, TSet<FName>& OutTags) const;
 	FPCGExEntryAccessResult GetEntry(int32 Index, int32 Seed, EPCGExIndexPickMode PickMode, uint8 TagInheritance, TSet<FName>& OutTags) const;
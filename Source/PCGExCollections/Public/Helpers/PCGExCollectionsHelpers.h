@@ -20,6 +20,11 @@ namespace PCGExDetails
 	class TSettingValue;
 }
 
+namespace PCGExMT
+{
+	struct FScope;
+}
+
 struct FPCGContext;
 struct FPCGMeshInstanceList;
 class UPCGBasePointData;
@@ -71,6 +76,14 @@ namespace PCGExCollections
 		 */
 		FPCGExEntryAccessResult GetEntry(int32 PointIndex, int32 Seed, uint8 TagInheritance, TSet<FName>& OutTags) const;
 
+		/**
+		 * Get entries for a contiguous range of points
+		 * @param Scope Range of point indices
+		 * @param Seeds Random seed for each point of the scope, relative to Scope.Start
+		 * @param OutResults Access results, relative to Scope.Start; resized to the scope size
+		 */
+		void GetEntries(const PCGExMT::FScope& Scope, TConstArrayView<int32> Seeds, TArray<FPCGExEntryAccessResult>& OutResults) const;
+
 		/** Get the underlying collection */
 		UPCGExAssetCollection* GetCollection() const { return Collection; }
 
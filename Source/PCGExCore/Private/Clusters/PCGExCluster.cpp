@@ -38,6 +38,13 @@ namespace PCGExClusters
 
 		BoundedEdges = OriginalCluster->BoundedEdges;
 
+		// Mirrors share the same topology, packed adjacency can be shared as-is
+		{
+			FReadScopeLock ReadScopeLock(OriginalCluster->ClusterLock);
+			CSR = OriginalCluster->CSR;
+		}
+		PackedLinks.store(CSR.Get(), std::memory_order_release);
+
 		if (bCopyNodes)
 		{
 			const int32 NumNewNodes = OriginalCluster->Nodes->Num();
@@ -832,6 +839,27 @@ namespace PCGExClusters
 		return BoundedEdges;
 	}
 
+	TSharedPtr<FClusterCSR> FCluster::GetCSR()
+	{
+		{
+			FReadScopeLock ReadScopeLock(ClusterLock);
+			if (CSR) { return CSR; }
+		}
+		{
+			FWriteScopeLock WriteScopeLock(ClusterLock);
+			if (CSR) { return CSR; }
+
+			const TSharedPtr<FClusterCSR> NewCSR = MakeShared<FClusterCSR>();
+			NewCSR->Build(this);
+			CSR = NewCSR;
+
+			// Accessors don't take the lock; release so they never observe a partially built CSR
+			PackedLinks.store(CSR.Get(), std::memory_order_release);
+		}
+
+		return CSR;
+	}
+
 	void FCluster::ExpandEdges(PCGExMT::FTaskManager* TaskManager)
 	{
 		if (BoundedEdges) { return; }
@@ -0,0 +1,54 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Clusters/PCGExClusterCSR.h"
+
+#include "Clusters/PCGExCluster.h"
+
+namespace PCGExClusters
+{
+	void FClusterCSR::Build(const FCluster* InCluster)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FClusterCSR::Build);
+
+		const TArray<FNode>& NodesRef = *InCluster->Nodes;
+		const TArray<PCGExGraphs::FEdge>& EdgesRef = *InCluster->Edges;
+
+		const int32 NumNodes = NodesRef.Num();
+		const int32 NumEdges = EdgesRef.Num();
+
+		Offsets.SetNumUninitialized(NumNodes + 1);
+
+		int32 NumTotalLinks = 0;
+		for (int i = 0; i < NumNodes; i++)
+		{
+			const FNode& Node = NodesRef[i];
+			Offsets[i] = NumTotalLinks;
+			NumTotalLinks += Node.Num();
+		}
+
+		Offsets[NumNodes] = NumTotalLinks;
+
+		Links.SetNumUninitialized(NumTotalLinks);
+		EdgeNodes.Init(-1, NumEdges * 2);
+
+		PCGExGraphs::FLink* LinksPtr = Links.GetData();
+		for (int i = 0; i < NumNodes; i++)
+		{
+			const FNode& Node = NodesRef[i];
+			FMemory::Memcpy(LinksPtr + Offsets[i], Node.Links.GetData(), Node.Num() * sizeof(PCGExGraphs::FLink));
+
+			for (const PCGExGraphs::FLink Lk : Node.Links)
+			{
+				// Edges store point indices, resolve which side of the edge this node is on
+				const int32 Side = EdgesRef[Lk.Edge].Start == Node.PointIndex ? 0 : 1;
+				EdgeNodes[Lk.Edge * 2 + Side] = i;
+			}
+		}
+	}
+
+	SIZE_T FClusterCSR::GetAllocatedSize() const
+	{
+		return Offsets.GetAllocatedSize() + Links.GetAllocatedSize() + EdgeNodes.GetAllocatedSize();
+	}
+}
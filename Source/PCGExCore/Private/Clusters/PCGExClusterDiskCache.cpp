@@ -0,0 +1,429 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Clusters/PCGExClusterDiskCache.h"
+
+#include <atomic>
+
+#include "PCGExSettingsCacheBody.h"
+#include "PCGExCoreSettingsCache.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Hash/xxhash.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Data/PCGExData.h"
+#include "Data/PCGExPointIO.h"
+#include "Clusters/PCGExCluster.h"
+#include "Clusters/PCGExClusterCommon.h"
+
+namespace PCGExClusters::DiskCache
+{
+	namespace Internal
+	{
+		constexpr uint32 Magic = 0x43584750; // PGXC
+		constexpr uint32 Version = 2;
+
+		// Cache I/O is blocking and runs on workers; past this many in-flight operations, skip the cache instead of piling up
+		constexpr int32 MaxConcurrentIO = 2;
+		static std::atomic<int32> ActiveIO{0};
+		static std::atomic<bool> bEvicting{false};
+
+		struct FHeader
+		{
+			uint32 Magic = 0;
+			uint32 Version = 0;
+			uint64 Id = 0;
+			uint64 HashLow = 0;
+			uint64 HashHigh = 0;
+			int32 NumRawVtx = 0;
+			int32 NumRawEdges = 0;
+			int32 NumNodes = 0;
+			int32 NumEdges = 0;
+			int32 NumLinks = 0;
+			int32 Padding = 0;
+		};
+
+		// Edges are stored without their IO index, which is execution-specific
+		struct FPackedEdge
+		{
+			uint32 Start = 0;
+			uint32 End = 0;
+			int32 Index = -1;
+			int32 PointIndex = -1;
+		};
+
+		class FIOSlot
+		{
+			bool bAcquired = false;
+
+		public:
+			FIOSlot()
+			{
+				int32 Current = ActiveIO.load();
+				while (Current < MaxConcurrentIO)
+				{
+					if (ActiveIO.compare_exchange_weak(Current, Current + 1))
+					{
+						bAcquired = true;
+						break;
+					}
+				}
+			}
+
+			~FIOSlot() { if (bAcquired) { ActiveIO.fetch_sub(1); } }
+
+			FORCEINLINE bool IsAcquired() const { return bAcquired; }
+		};
+
+		static int64 GetExpectedSize(const FHeader& Header)
+		{
+			return static_cast<int64>(sizeof(FHeader))
+				+ static_cast<int64>(sizeof(int32)) * Header.NumNodes       // Point indices
+				+ static_cast<int64>(sizeof(int32)) * (Header.NumNodes + 1) // Link offsets
+				+ static_cast<int64>(sizeof(FLink)) * Header.NumLinks
+				+ static_cast<int64>(sizeof(FPackedEdge)) * Header.NumEdges;
+		}
+
+		template <typename T>
+		static const T* Read(const uint8*& Cursor, const int32 Num)
+		{
+			const T* Ptr = reinterpret_cast<const T*>(Cursor);
+			Cursor += sizeof(T) * Num;
+			return Ptr;
+		}
+
+		template <typename T>
+		static void Write(TArray<uint8>& Blob, const T* Data, const int32 Num)
+		{
+			Blob.Append(reinterpret_cast<const uint8*>(Data), sizeof(T) * Num);
+		}
+
+		/** Validates the whole blob and decodes it into temporaries. Nothing is written to the cluster. */
+		static bool Decode(const uint8* Data, const int64 Size, const FKey& Key, const int32 NumRawVtx, const int32 NumRawEdges, const int32 EdgeIOIndex, TArray<FNode>& OutNodes, TArray<FEdge>& OutEdges)
+		{
+			if (Size < static_cast<int64>(sizeof(FHeader))) { return false; }
+
+			const uint8* Cursor = Data;
+			const FHeader& Header = *Read<FHeader>(Cursor, 1);
+
+			if (Header.Magic != Magic ||
+				Header.Version != Version ||
+				Header.Id != Key.Id ||
+				Header.HashLow != Key.HashLow ||
+				Header.HashHigh != Key.HashHigh ||
+				Header.NumRawVtx != NumRawVtx ||
+				Header.NumRawEdges != NumRawEdges ||
+				Header.NumNodes < 0 || Header.NumNodes > NumRawVtx ||
+				Header.NumEdges < 0 || Header.NumEdges > NumRawEdges ||
+				Header.NumLinks < 0 ||
+				Size != GetExpectedSize(Header))
+			{
+				return false;
+			}
+
+			const int32 NumNodes = Header.NumNodes;
+			const int32 NumEdges = Header.NumEdges;
+			const int32 NumLinks = Header.NumLinks;
+
+			const int32* PointIndices = Read<int32>(Cursor, NumNodes);
+			const int32* Offsets = Read<int32>(Cursor, NumNodes + 1);
+			const FLink* Links = Read<FLink>(Cursor, NumLinks);
+			const FPackedEdge* PackedEdges = Read<FPackedEdge>(Cursor, NumEdges);
+
+			if (Offsets[0] != 0 || Offsets[NumNodes] != NumLinks) { return false; }
+
+			// Point index -> node must be a proper injection
+			TBitArray<> UsedPoints(false, NumRawVtx);
+
+			OutNodes.SetNum(NumNodes);
+			for (int i = 0; i < NumNodes; i++)
+			{
+				const int32 PointIndex = PointIndices[i];
+				if (PointIndex < 0 || PointIndex >= NumRawVtx || UsedPoints[PointIndex]) { return false; }
+				UsedPoints[PointIndex] = true;
+
+				const int32 Start = Offsets[i];
+				const int32 End = Offsets[i + 1];
+				if (End < Start || End > NumLinks) { return false; }
+
+				for (int32 l = Start; l < End; l++)
+				{
+					const FLink& Lk = Links[l];
+					if (Lk.Node < 0 || Lk.Node >= NumNodes || Lk.Edge < 0 || Lk.Edge >= NumEdges) { return false; }
+				}
+
+				FNode& Node = (OutNodes[i] = FNode(i, PointIndex));
+				Node.Links.Append(Links + Start, End - Start);
+			}
+
+			OutEdges.SetNum(NumEdges);
+			for (int i = 0; i < NumEdges; i++)
+			{
+				const FPackedEdge& E = PackedEdges[i];
+
+				if (E.Start >= static_cast<uint32>(NumRawVtx) || E.End >= static_cast<uint32>(NumRawVtx) ||
+					!UsedPoints[E.Start] || !UsedPoints[E.End] ||
+					E.Index < 0 || E.Index >= NumEdges ||
+					E.PointIndex < -1 || E.PointIndex >= NumRawEdges)
+				{
+					return false;
+				}
+
+				OutEdges[i] = FEdge(E.Index, E.Start, E.End, E.PointIndex, EdgeIOIndex);
+			}
+
+			return true;
+		}
+
+		/** Drops least recently used blobs until the directory fits the configured cap. Only one eviction runs at a time. */
+		static void Evict()
+		{
+			bool bExpected = false;
+			if (!bEvicting.compare_exchange_strong(bExpected, true)) { return; }
+
+			TRACE_CPUPROFILER_EVENT_SCOPE(PCGExClusters::DiskCache::Evict);
+
+			struct FEntry
+			{
+				FString Path;
+				int64 Size = 0;
+				FDateTime Time;
+			};
+
+			const int64 MaxSize = static_cast<int64>(FMath::Max(1, PCGEX_CORE_SETTINGS.PersistentClusterCacheMaxSizeMB)) * 1024 * 1024;
+			const FString Directory = GetCacheDirectory();
+
+			TArray<FEntry> Entries;
+			int64 TotalSize = 0;
+
+			IFileManager::Get().IterateDirectoryStat(
+				*Directory, [&](const TCHAR* InPath, const FFileStatData& Stat)
+				{
+					if (!Stat.bIsDirectory && FPaths::GetExtension(InPath) == TEXT("pcgexc"))
+					{
+						Entries.Add(FEntry{InPath, Stat.FileSize, Stat.ModificationTime});
+						TotalSize += Stat.FileSize;
+					}
+					return true;
+				});
+
+			if (TotalSize > MaxSize)
+			{
+				Entries.Sort([](const FEntry& A, const FEntry& B) { return A.Time < B.Time; });
+				for (const FEntry& Entry : Entries)
+				{
+					if (TotalSize <= MaxSize) { break; }
+					if (IFileManager::Get().Delete(*Entry.Path, false, true, true)) { TotalSize -= Entry.Size; }
+				}
+			}
+
+			bEvicting.store(false);
+		}
+	}
+
+	bool IsEnabled(const int32 NumVtx)
+	{
+		return PCGEX_CORE_SETTINGS.bPersistentClusterCache && NumVtx >= PCGEX_CORE_SETTINGS.PersistentClusterCacheMinNodes;
+	}
+
+	FKey ComputeKey(const TSharedRef<PCGExData::FPointIO>& VtxIO, const TSharedRef<PCGExData::FPointIO>& EdgesIO)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExClusters::DiskCache::ComputeKey);
+
+		FKey Key;
+
+		const TUniquePtr<PCGExData::TArrayBuffer<int64>> VtxBuffer = MakeUnique<PCGExData::TArrayBuffer<int64>>(VtxIO, Labels::Attr_PCGExVtxIdx);
+		if (!VtxBuffer->InitForRead()) { return Key; }
+
+		const TUniquePtr<PCGExData::TArrayBuffer<int64>> EdgesBuffer = MakeUnique<PCGExData::TArrayBuffer<int64>>(EdgesIO, Labels::Attr_PCGExEdgeIdx);
+		if (!EdgesBuffer->InitForRead()) { return Key; }
+
+		const TArray<int64>& VtxEndpoints = *VtxBuffer->GetInValues().Get();
+		const TArray<int64>& EdgesEndpoints = *EdgesBuffer->GetInValues().Get();
+
+		const uint32 VtxCrc = FCrc::MemCrc32(VtxEndpoints.GetData(), VtxEndpoints.Num() * sizeof(int64), VtxEndpoints.Num());
+		const uint32 EdgesCrc = FCrc::MemCrc32(EdgesEndpoints.GetData(), EdgesEndpoints.Num() * sizeof(int64), EdgesEndpoints.Num());
+
+		// Full content hash, so a short key collision can never load the wrong topology
+		FXxHash128Builder Builder;
+		Builder.Update(VtxEndpoints.GetData(), VtxEndpoints.Num() * sizeof(int64));
+		Builder.Update(EdgesEndpoints.GetData(), EdgesEndpoints.Num() * sizeof(int64));
+
+		constexpr int32 ChunkSize = 4096;
+		TArray<FVector> Chunk;
+		Chunk.Reserve(ChunkSize);
+
+		for (const FTransform& Transform : VtxIO->GetIn()->GetConstTransformValueRange())
+		{
+			Chunk.Add(Transform.GetLocation());
+			if (Chunk.Num() == ChunkSize)
+			{
+				Builder.Update(Chunk.GetData(), Chunk.Num() * sizeof(FVector));
+				Chunk.Reset();
+			}
+		}
+
+		if (!Chunk.IsEmpty()) { Builder.Update(Chunk.GetData(), Chunk.Num() * sizeof(FVector)); }
+
+		const FXxHash128 Hash = Builder.Finalize();
+
+		Key.Id = PCGEx::H64(VtxCrc, EdgesCrc);
+		Key.HashLow = Hash.HashLow;
+		Key.HashHigh = Hash.HashHigh;
+
+		return Key;
+	}
+
+	FString GetCacheDirectory()
+	{
+		const FString& Directory = PCGEX_CORE_SETTINGS.PersistentClusterCacheDirectory;
+		if (Directory.IsEmpty()) { return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("PCGEx"), TEXT("ClusterCache")); }
+		return Directory;
+	}
+
+	FString GetCachePath(const uint64 Id)
+	{
+		return FPaths::Combine(GetCacheDirectory(), FString::Printf(TEXT("%016llx.pcgexc"), Id));
+	}
+
+	bool TryLoad(const TSharedRef<FCluster>& InCluster, const FKey& Key)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExClusters::DiskCache::TryLoad);
+
+		if (!Key.IsValid()) { return false; }
+
+		const TSharedPtr<PCGExData::FPointIO> PinnedVtxIO = InCluster->VtxIO.Pin();
+		const TSharedPtr<PCGExData::FPointIO> PinnedEdgesIO = InCluster->EdgesIO.Pin();
+		if (!PinnedVtxIO || !PinnedEdgesIO) { return false; }
+
+		const Internal::FIOSlot Slot;
+		if (!Slot.IsAcquired()) { return false; }
+
+		const FString Path = GetCachePath(Key.Id);
+
+		const int32 NumRawVtx = PinnedVtxIO->GetNum();
+		const int32 NumRawEdges = PinnedEdgesIO->GetNum();
+
+		TArray<FNode> NewNodes;
+		TArray<FEdge> NewEdges;
+
+		{
+			TUniquePtr<IMappedFileHandle> MappedFile(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*Path));
+			if (!MappedFile) { return false; }
+
+			const TUniquePtr<IMappedFileRegion> Region(MappedFile->MapRegion(0, MappedFile->GetFileSize()));
+			if (!Region) { return false; }
+
+			if (!Internal::Decode(Region->GetMappedPtr(), Region->GetMappedSize(), Key, NumRawVtx, NumRawEdges, PinnedEdgesIO->IOIndex, NewNodes, NewEdges))
+			{
+				return false;
+			}
+		}
+
+		// Blob is valid, swap it in
+		FCluster& Cluster = InCluster.Get();
+
+		Cluster.VtxTransforms = PinnedVtxIO->GetIn()->GetConstTransformValueRange();
+		Cluster.NumRawVtx = NumRawVtx;
+		Cluster.NumRawEdges = NumRawEdges;
+		Cluster.Bounds = FBox(ForceInit);
+
+		TArray<FNode>& Nodes = *Cluster.Nodes;
+		TArray<FEdge>& Edges = *Cluster.Edges;
+
+		Nodes = MoveTemp(NewNodes);
+		Edges = MoveTemp(NewEdges);
+
+		for (const FNode& Node : Nodes)
+		{
+			Cluster.NodeIndexLookup->GetMutable(Node.PointIndex) = Node.Index;
+			Cluster.Bounds += Cluster.VtxTransforms[Node.PointIndex].GetLocation();
+		}
+
+		Cluster.Bounds = Cluster.Bounds.ExpandBy(10);
+
+		Cluster.NodesDataPtr = Nodes.GetData();
+		Cluster.EdgesDataPtr = Edges.GetData();
+
+		// Keep eviction least-recently-used
+		IFileManager::Get().SetTimeStamp(*Path, FDateTime::UtcNow());
+
+		return true;
+	}
+
+	bool Save(const TSharedRef<FCluster>& InCluster, const FKey& Key)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExClusters::DiskCache::Save);
+
+		if (!Key.IsValid()) { return false; }
+
+		const Internal::FIOSlot Slot;
+		if (!Slot.IsAcquired()) { return false; }
+
+		const FCluster& Cluster = InCluster.Get();
+		const TArray<FNode>& Nodes = *Cluster.Nodes;
+		const TArray<FEdge>& Edges = *Cluster.Edges;
+
+		Internal::FHeader Header;
+		Header.Magic = Internal::Magic;
+		Header.Version = Internal::Version;
+		Header.Id = Key.Id;
+		Header.HashLow = Key.HashLow;
+		Header.HashHigh = Key.HashHigh;
+		Header.NumRawVtx = Cluster.NumRawVtx;
+		Header.NumRawEdges = Cluster.NumRawEdges;
+		Header.NumNodes = Nodes.Num();
+		Header.NumEdges = Edges.Num();
+		TArray<int32> PointIndices;
+		TArray<int32> Offsets;
+		TArray<FLink> Links;
+		TArray<Internal::FPackedEdge> PackedEdges;
+
+		PointIndices.SetNumUninitialized(Header.NumNodes);
+		Offsets.SetNumUninitialized(Header.NumNodes + 1);
+
+		for (int i = 0; i < Header.NumNodes; i++)
+		{
+			const FNode& Node = Nodes[i];
+			PointIndices[i] = Node.PointIndex;
+			Offsets[i] = Links.Num();
+			Links.Append(Node.Links);
+		}
+
+		Offsets[Header.NumNodes] = Links.Num();
+		Header.NumLinks = Links.Num();
+
+		PackedEdges.SetNumUninitialized(Header.NumEdges);
+		for (int i = 0; i < Header.NumEdges; i++)
+		{
+			const FEdge& E = Edges[i];
+			PackedEdges[i] = Internal::FPackedEdge{E.Start, E.End, E.Index, E.PointIndex};
+		}
+
+		TArray<uint8> Blob;
+		Blob.Reserve(Internal::GetExpectedSize(Header));
+
+		Internal::Write(Blob, &Header, 1);
+		Internal::Write(Blob, PointIndices.GetData(), PointIndices.Num());
+		Internal::Write(Blob, Offsets.GetData(), Offsets.Num());
+		Internal::Write(Blob, Links.GetData(), Links.Num());
+		Internal::Write(Blob, PackedEdges.GetData(), PackedEdges.Num());
+
+		// Write to a unique temp file first so concurrent writers or readers never see a partial blob
+		const FString Path = GetCachePath(Key.Id);
+		const FString TempPath = Path + TEXT(".") + FGuid::NewGuid().ToString() + TEXT(".tmp");
+
+		if (!FFileHelper::SaveArrayToFile(Blob, *TempPath)) { return false; }
+		if (!IFileManager::Get().Move(*Path, *TempPath, true, true))
+		{
+			IFileManager::Get().Delete(*TempPath, false, true, true);
+			return false;
+		}
+
+		Internal::Evict();
+
+		return true;
+	}
+}
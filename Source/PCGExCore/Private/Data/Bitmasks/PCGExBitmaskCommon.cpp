@@ -33,6 +33,31 @@ namespace PCGExBitmask
 		}
 	}
 
+	void CompareScope(const EPCGExBitflagComparison Method, TConstArrayView<int64> Flags, TConstArrayView<int64> Masks, TArrayView<int8> OutResults)
+	{
+		const int32 Num = OutResults.Num();
+		check(Flags.Num() == Num && Masks.Num() == Num);
+
+		const int64* RESTRICT FPtr = Flags.GetData();
+		const int64* RESTRICT MPtr = Masks.GetData();
+		int8* RESTRICT OutPtr = OutResults.GetData();
+
+#define PCGEX_BITMASK_SCOPE(_EXPR) for (int i = 0; i < Num; i++) { const int64 F = FPtr[i]; const int64 M = MPtr[i]; OutPtr[i] &= static_cast<int8>(_EXPR); } break;
+
+		switch (Method)
+		{
+		case EPCGExBitflagComparison::MatchPartial: PCGEX_BITMASK_SCOPE((F & M) != 0)
+		case EPCGExBitflagComparison::MatchFull: PCGEX_BITMASK_SCOPE((F & M) == M)
+		case EPCGExBitflagComparison::MatchStrict: PCGEX_BITMASK_SCOPE(F == M)
+		case EPCGExBitflagComparison::NoMatchPartial: PCGEX_BITMASK_SCOPE((F & M) == 0)
+		case EPCGExBitflagComparison::NoMatchFull: PCGEX_BITMASK_SCOPE((F & M) != M)
+		default: for (int i = 0; i < Num; i++) { OutPtr[i] = 0; }
+			break;
+		}
+
+#undef PCGEX_BITMASK_SCOPE
+	}
+
 	void Mutate(const TArray<FPCGExBitmaskRef>& Compositions, int64& Flags)
 	{
 		for (const FPCGExBitmaskRef& Comp : Compositions) { Comp.Mutate(Flags); }
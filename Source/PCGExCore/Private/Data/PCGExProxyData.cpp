@@ -199,6 +199,24 @@ namespace PCGExData
 		// Default: no-op. Override in property proxies.
 	}
 
+	void IBufferProxy::GetVoidRange(const int32 Start, const int32 Count, void* OutValues) const
+	{
+		check(!bWorkingTypeNeedsLifecycle)
+
+		const int32 Stride = WorkingOps->GetTypeSize();
+		uint8* Out = static_cast<uint8*>(OutValues);
+		for (int32 i = 0; i < Count; i++) { GetVoid(Start + i, Out + i * Stride); }
+	}
+
+	void IBufferProxy::SetVoidRange(const int32 Start, const int32 Count, const void* Values) const
+	{
+		check(!bWorkingTypeNeedsLifecycle)
+
+		const int32 Stride = WorkingOps->GetTypeSize();
+		const uint8* In = static_cast<const uint8*>(Values);
+		for (int32 i = 0; i < Count; i++) { SetVoid(Start + i, In + i * Stride); }
+	}
+
 	// Converting read implementations - Now using FScopedTypedValue for safety
 #define PCGEX_CONVERTING_READ_IMPL(_TYPE, _NAME, ...) \
 	_TYPE IBufferProxy::ReadAs##_NAME(const int32 Index) const \
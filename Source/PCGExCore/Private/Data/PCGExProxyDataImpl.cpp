@@ -42,6 +42,24 @@ namespace PCGExData
 		else { *(Buffer->GetData() + Index) = *static_cast<const T_REAL*>(Value); }
 	}
 
+	template <typename T_REAL>
+	void TRawBufferProxy<T_REAL>::GetVoidRange(const int32 Start, const int32 Count, void* OutValues) const
+	{
+		check(Buffer);
+
+		if (RealType != WorkingType) { IBufferProxy::GetVoidRange(Start, Count, OutValues); }
+		else { FMemory::Memcpy(OutValues, Buffer->GetData() + Start, Count * sizeof(T_REAL)); }
+	}
+
+	template <typename T_REAL>
+	void TRawBufferProxy<T_REAL>::SetVoidRange(const int32 Start, const int32 Count, const void* Values) const
+	{
+		check(Buffer);
+
+		if (RealType != WorkingType) { IBufferProxy::SetVoidRange(Start, Count, Values); }
+		else { FMemory::Memcpy(Buffer->GetData() + Start, Values, Count * sizeof(T_REAL)); }
+	}
+
 	template <typename T_REAL>
 	PCGExValueHash TRawBufferProxy<T_REAL>::ReadValueHash(const int32 Index) const
 	{
@@ -132,6 +150,28 @@ namespace PCGExData
 		}
 	}
 
+	template <typename T_REAL>
+	void TAttributeBufferProxy<T_REAL>::GetVoidRange(const int32 Start, const int32 Count, void* OutValues) const
+	{
+		check(Buffer);
+
+		if (bWantsSubSelection || RealType != WorkingType) { IBufferProxy::GetVoidRange(Start, Count, OutValues); }
+		else { Buffer->Read(Start, TArrayView<T_REAL>(static_cast<T_REAL*>(OutValues), Count)); }
+	}
+
+	template <typename T_REAL>
+	void TAttributeBufferProxy<T_REAL>::SetVoidRange(const int32 Start, const int32 Count, const void* Values) const
+	{
+		check(Buffer);
+
+		if (bWantsSubSelection || RealType != WorkingType) { IBufferProxy::SetVoidRange(Start, Count, Values); }
+		else
+		{
+			const T_REAL* In = static_cast<const T_REAL*>(Values);
+			for (int32 i = 0; i < Count; i++) { Buffer->SetValue(Start + i, In[i]); }
+		}
+	}
+
 	template <typename T_REAL>
 	TSharedPtr<IBuffer> TAttributeBufferProxy<T_REAL>::GetBuffer() const
 	{
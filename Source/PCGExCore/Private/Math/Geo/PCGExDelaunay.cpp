@@ -12,9 +12,572 @@
 #include "Async/ParallelFor.h"
 #include "Math/Geo/PCGExGeo.h"
 #include "Math/PCGExProjectionDetails.h"
+#include "Helpers/PCGExArrayHelpers.h"
+
+#include <atomic>
 
 namespace PCGExMath::Geo
 {
+	namespace DelaunayTiling
+	{
+		static bool IsEnabled(const int32 NumPoints)
+		{
+			return PCGEX_CORE_SETTINGS.bParallelDelaunay && NumPoints >= PCGEX_CORE_SETTINGS.ParallelDelaunayMinPoints;
+		}
+
+		static int32 GetNumSlabs(const int32 NumPoints, const int32 MinSlabSize, const int32 MaxSlabs)
+		{
+			return FMath::Clamp(NumPoints / MinSlabSize, 1, FMath::Min(MaxSlabs, FPlatformMisc::NumberOfCoresIncludingHyperthreads()));
+		}
+
+		// Equal-count partition of the points along X.
+		// Slabs are unbounded on the other axes; Lo/Hi are halfway between the last point of a slab and the first of the next one.
+		struct FSlabs
+		{
+			TArray<int32> Order;
+			TArray<int32> Starts;
+			TArray<double> Lo;
+			TArray<double> Hi;
+			double Tolerance = 0;
+
+			int32 Num() const { return Lo.Num(); }
+			int32 Start(const int32 Slab) const { return Starts[Slab]; }
+			int32 Count(const int32 Slab) const { return Starts[Slab + 1] - Starts[Slab]; }
+
+			// Whether a circumcircle/sphere lies strictly inside a slab, meaning no other slab's point can invalidate it
+			FORCEINLINE bool Contains(const int32 Slab, const double CenterX, const double Radius) const
+			{
+				return CenterX - Radius > Lo[Slab] + Tolerance && CenterX + Radius < Hi[Slab] - Tolerance;
+			}
+		};
+
+		template <typename FGetX>
+		static void BuildSlabs(const int32 NumPoints, const int32 NumSlabs, FGetX&& GetX, FSlabs& OutSlabs)
+		{
+			PCGExArrayHelpers::ArrayOfIndices(OutSlabs.Order, NumPoints);
+			OutSlabs.Order.Sort(
+				[&](const int32 A, const int32 B)
+				{
+					const double XA = GetX(A);
+					const double XB = GetX(B);
+					return XA == XB ? A < B : XA < XB;
+				});
+
+			OutSlabs.Starts.SetNumUninitialized(NumSlabs + 1);
+			for (int32 i = 0; i <= NumSlabs; i++) { OutSlabs.Starts[i] = static_cast<int32>(static_cast<int64>(NumPoints) * i / NumSlabs); }
+
+			OutSlabs.Lo.SetNumUninitialized(NumSlabs);
+			OutSlabs.Hi.SetNumUninitialized(NumSlabs);
+
+			for (int32 i = 0; i < NumSlabs; i++)
+			{
+				const int32 Start = OutSlabs.Starts[i];
+				const int32 End = OutSlabs.Starts[i + 1];
+
+				OutSlabs.Lo[i] = i == 0 ? -MAX_dbl : (GetX(OutSlabs.Order[Start - 1]) + GetX(OutSlabs.Order[Start])) * 0.5;
+				OutSlabs.Hi[i] = i == NumSlabs - 1 ? MAX_dbl : (GetX(OutSlabs.Order[End - 1]) + GetX(OutSlabs.Order[End])) * 0.5;
+			}
+
+			OutSlabs.Tolerance = (GetX(OutSlabs.Order.Last()) - GetX(OutSlabs.Order[0])) * 1e-9;
+		}
+
+		FORCEINLINE static size_t NextHalfEdge(const size_t E) { return E % 3 == 2 ? E - 2 : E + 1; }
+
+		struct FTiledTriangulation2
+		{
+			TArray<TArray<int32>> SlabTriangles;
+			TArray<int32> SeamTriangles;
+			TArray<int32> Hull;
+		};
+
+		/**
+		 * Triangulate each slab independently, keep the triangles whose circumcircle is contained in their slab (final),
+		 * then triangulate the vertices of every other triangle (plus slab hulls) and keep the seam triangles that aren't
+		 * already covered by final ones. Returns false whenever the seams can't be stitched reliably, so the caller can fall back.
+		 */
+		static bool TriangulateTiled2(const std::vector<double>& Coords, FTiledTriangulation2& Out)
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay2D::TriangulateTiled);
+
+			const int32 NumPoints = static_cast<int32>(Coords.size() / 2);
+			const int32 NumSlabs = GetNumSlabs(NumPoints, 16384, 64);
+
+			if (NumSlabs < 2) { return false; }
+
+			FSlabs Slabs;
+			BuildSlabs(NumPoints, NumSlabs, [&](const int32 i) { return Coords[i * 2]; }, Slabs);
+
+			// Directed edge of a final triangle whose other side is either another slab's business or the slab hull
+			struct FSeamEdge
+			{
+				int32 A;
+				int32 B;
+			};
+
+			// Each point is only ever written by the slab that owns it
+			TArray<int8> IsBorder;
+			IsBorder.Init(0, NumPoints);
+
+			TArray<TArray<FSeamEdge>> SeamEdges;
+			SeamEdges.SetNum(NumSlabs);
+			Out.SlabTriangles.SetNum(NumSlabs);
+
+			std::atomic<bool> bFailed{false};
+
+			ParallelFor(
+				NumSlabs, [&](const int32 Slab)
+				{
+					TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay2D::TriangulateSlab);
+
+					const int32 Start = Slabs.Start(Slab);
+					const int32 Count = Slabs.Count(Slab);
+					const int32* ToGlobal = Slabs.Order.GetData() + Start;
+
+					std::vector<double> LocalCoords(Count * 2);
+					for (int32 i = 0; i < Count; i++)
+					{
+						LocalCoords[i * 2] = Coords[ToGlobal[i] * 2];
+						LocalCoords[i * 2 + 1] = Coords[ToGlobal[i] * 2 + 1];
+					}
+
+					delaunator::Delaunator d(LocalCoords);
+
+					if (d.runtime_error || d.triangles.empty())
+					{
+						bFailed = true;
+						return;
+					}
+
+					const int32 NumTriangles = static_cast<int32>(d.triangles.size() / 3);
+
+					TBitArray<> Final;
+					Final.Init(false, NumTriangles);
+
+					for (int32 t = 0; t < NumTriangles; t++)
+					{
+						const double AX = LocalCoords[d.triangles[t * 3] * 2];
+						const double AY = LocalCoords[d.triangles[t * 3] * 2 + 1];
+						const double BX = LocalCoords[d.triangles[t * 3 + 1] * 2] - AX;
+						const double BY = LocalCoords[d.triangles[t * 3 + 1] * 2 + 1] - AY;
+						const double CX = LocalCoords[d.triangles[t * 3 + 2] * 2] - AX;
+						const double CY = LocalCoords[d.triangles[t * 3 + 2] * 2 + 1] - AY;
+
+						const double D = 2.0 * (BX * CY - BY * CX);
+						if (D == 0) { continue; }
+
+						const double B2 = BX * BX + BY * BY;
+						const double C2 = CX * CX + CY * CY;
+						const double UX = (CY * B2 - BY * C2) / D;
+						const double UY = (BX * C2 - CX * B2) / D;
+
+						Final[t] = Slabs.Contains(Slab, AX + UX, FMath::Sqrt(UX * UX + UY * UY));
+					}
+
+					TArray<int32>& OutTriangles = Out.SlabTriangles[Slab];
+					TArray<FSeamEdge>& OutSeamEdges = SeamEdges[Slab];
+					OutTriangles.Reserve(d.triangles.size());
+
+					for (int32 t = 0; t < NumTriangles; t++)
+					{
+						if (!Final[t])
+						{
+							for (int32 k = 0; k < 3; k++) { IsBorder[ToGlobal[d.triangles[t * 3 + k]]] = 1; }
+							continue;
+						}
+
+						for (int32 k = 0; k < 3; k++) { OutTriangles.Add(ToGlobal[d.triangles[t * 3 + k]]); }
+
+						for (int32 k = 0; k < 3; k++)
+						{
+							const size_t E = t * 3 + k;
+							const size_t Opposite = d.halfedges[E];
+
+							if (Opposite != delaunator::INVALID_INDEX && Final[static_cast<int32>(Opposite / 3)]) { continue; }
+
+							const int32 A = ToGlobal[d.triangles[E]];
+							const int32 B = ToGlobal[d.triangles[NextHalfEdge(E)]];
+							OutSeamEdges.Add(FSeamEdge{A, B});
+
+							// Slab hull, what lies beyond is only known to the seam triangulation
+							if (Opposite == delaunator::INVALID_INDEX)
+							{
+								IsBorder[A] = 1;
+								IsBorder[B] = 1;
+							}
+						}
+					}
+				});
+
+			if (bFailed) { return false; }
+
+			TArray<int32> Border;
+			PCGExArrayHelpers::ArrayOfIndices(Border, IsBorder, 0);
+			IsBorder.Empty();
+
+			// Seams dominate, a single pass is cheaper
+			const int32 NumBorder = Border.Num();
+			if (NumBorder < 3 || NumBorder > NumPoints / 2) { return false; }
+
+			TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay2D::StitchSeams);
+
+			std::vector<double> BorderCoords(NumBorder * 2);
+			for (int32 i = 0; i < NumBorder; i++)
+			{
+				BorderCoords[i * 2] = Coords[Border[i] * 2];
+				BorderCoords[i * 2 + 1] = Coords[Border[i] * 2 + 1];
+			}
+
+			delaunator::Delaunator Seam(BorderCoords);
+			if (Seam.runtime_error || Seam.triangles.empty()) { return false; }
+
+			const int32 NumSeamHalfEdges = static_cast<int32>(Seam.triangles.size());
+			const int32 NumSeamTriangles = NumSeamHalfEdges / 3;
+
+			TMap<uint64, int32> HalfEdgeMap;
+			HalfEdgeMap.Reserve(NumSeamHalfEdges);
+			for (int32 e = 0; e < NumSeamHalfEdges; e++)
+			{
+				HalfEdgeMap.Add(PCGEx::H64(Border[static_cast<int32>(Seam.triangles[e])], Border[static_cast<int32>(Seam.triangles[NextHalfEdge(e)])]), e);
+			}
+
+			// Both triangulations share the same orientation, so the seam triangle holding the same directed edge
+			// lies on the final side of it and is already covered.
+			TSet<uint64> Blocked;
+			TBitArray<> Covered;
+			Covered.Init(false, NumSeamTriangles);
+			TArray<int32> Stack;
+
+			for (const TArray<FSeamEdge>& SlabSeamEdges : SeamEdges)
+			{
+				for (const FSeamEdge& Edge : SlabSeamEdges)
+				{
+					if (const int32* E = HalfEdgeMap.Find(PCGEx::H64(Edge.A, Edge.B)))
+					{
+						const int32 T = *E / 3;
+						if (!Covered[T])
+						{
+							Covered[T] = true;
+							Stack.Add(T);
+						}
+					}
+					else if (!HalfEdgeMap.Contains(PCGEx::H64(Edge.B, Edge.A)))
+					{
+						// Co-circular points were resolved differently on each side
+						return false;
+					}
+
+					Blocked.Add(PCGEx::H64U(Edge.A, Edge.B));
+				}
+			}
+
+			SeamEdges.Empty();
+
+			while (!Stack.IsEmpty())
+			{
+				const int32 T = Stack.Pop(EAllowShrinking::No);
+
+				for (int32 k = 0; k < 3; k++)
+				{
+					const size_t E = T * 3 + k;
+					const size_t Opposite = Seam.halfedges[E];
+					if (Opposite == delaunator::INVALID_INDEX) { continue; }
+
+					const int32 Other = static_cast<int32>(Opposite / 3);
+					if (Covered[Other] || Blocked.Contains(PCGEx::H64U(Border[static_cast<int32>(Seam.triangles[E])], Border[static_cast<int32>(Seam.triangles[NextHalfEdge(E)])]))) { continue; }
+
+					Covered[Other] = true;
+					Stack.Add(Other);
+				}
+			}
+
+			Out.SeamTriangles.Reserve(NumSeamHalfEdges);
+			for (int32 t = 0; t < NumSeamTriangles; t++)
+			{
+				if (Covered[t]) { continue; }
+				for (int32 k = 0; k < 3; k++) { Out.SeamTriangles.Add(Border[static_cast<int32>(Seam.triangles[t * 3 + k])]); }
+			}
+
+			// Slab hull vertices are all border vertices, so the seam hull is the global hull
+			size_t H = Seam.hull_start;
+			do
+			{
+				Out.Hull.Add(Border[static_cast<int32>(H)]);
+				H = Seam.hull_next[H];
+			}
+			while (H != Seam.hull_start);
+
+			return true;
+		}
+
+		FORCEINLINE static FIntVector GetFaceKey(const FIntVector4& Tetrahedron, const int32 Face)
+		{
+			int32 A = Tetrahedron[MTX[Face][0]];
+			int32 B = Tetrahedron[MTX[Face][1]];
+			int32 C = Tetrahedron[MTX[Face][2]];
+			if (A > B) { Swap(A, B); }
+			if (B > C) { Swap(B, C); }
+			if (A > B) { Swap(A, B); }
+			return FIntVector(A, B, C);
+		}
+
+		FORCEINLINE static double Orient(const TArrayView<FVector>& Positions, const FIntVector& Face, const int32 Index)
+		{
+			const FVector& A = Positions[Face.X];
+			return FVector::DotProduct(FVector::CrossProduct(Positions[Face.Y] - A, Positions[Face.Z] - A), Positions[Index] - A);
+		}
+
+		/** 3D counterpart of TriangulateTiled2. Faces are matched by sorted vertex triplets, sides by orientation. */
+		static bool TetrahedralizeTiled(const TArrayView<FVector>& Positions, TArray<FIntVector4>& OutTetrahedra)
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay3D::TetrahedralizeTiled);
+
+			const int32 NumPoints = Positions.Num();
+
+			// Seams are surfaces in 3D and grow much faster with the number of slabs
+			const int32 NumSlabs = GetNumSlabs(NumPoints, 65536, 8);
+
+			if (NumSlabs < 2) { return false; }
+
+			FSlabs Slabs;
+			BuildSlabs(NumPoints, NumSlabs, [&](const int32 i) { return Positions[i].X; }, Slabs);
+
+			// Face of a final tetrahedron whose other side is either another slab's business or the slab hull
+			struct FSeamFace
+			{
+				FIntVector Face;
+				int32 Opposite;
+			};
+
+			TArray<int8> IsBorder;
+			IsBorder.Init(0, NumPoints);
+
+			TArray<TArray<FSeamFace>> SeamFaces;
+			SeamFaces.SetNum(NumSlabs);
+
+			TArray<TArray<FIntVector4>> SlabTetrahedra;
+			SlabTetrahedra.SetNum(NumSlabs);
+
+			std::atomic<bool> bFailed{false};
+
+			ParallelFor(
+				NumSlabs, [&](const int32 Slab)
+				{
+					TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay3D::TetrahedralizeSlab);
+
+					const int32 Start = Slabs.Start(Slab);
+					const int32 Count = Slabs.Count(Slab);
+					const int32* ToGlobal = Slabs.Order.GetData() + Start;
+
+					TArray<FVector> LocalPositions;
+					LocalPositions.SetNumUninitialized(Count);
+					for (int32 i = 0; i < Count; i++) { LocalPositions[i] = Positions[ToGlobal[i]]; }
+
+					UE::Geometry::FDelaunay3 Tetrahedralization;
+					if (!Tetrahedralization.Triangulate(LocalPositions))
+					{
+						bFailed = true;
+						return;
+					}
+
+					TArray<FIntVector4> Tetrahedra = Tetrahedralization.GetTetrahedra();
+					const int32 NumTetrahedra = Tetrahedra.Num();
+
+					TBitArray<> Final;
+					Final.Init(false, NumTetrahedra);
+
+					for (int32 t = 0; t < NumTetrahedra; t++)
+					{
+						FIntVector4& Tetrahedron = Tetrahedra[t];
+						for (int32 k = 0; k < 4; k++) { Tetrahedron[k] = ToGlobal[Tetrahedron[k]]; }
+
+						const FVector& A = Positions[Tetrahedron.X];
+						const FVector U = Positions[Tetrahedron.Y] - A;
+						const FVector V = Positions[Tetrahedron.Z] - A;
+						const FVector W = Positions[Tetrahedron.W] - A;
+
+						const FVector VxW = FVector::CrossProduct(V, W);
+						const double D = 2.0 * FVector::DotProduct(U, VxW);
+						if (D == 0) { continue; }
+
+						const FVector Offset = (VxW * U.SizeSquared() + FVector::CrossProduct(W, U) * V.SizeSquared() + FVector::CrossProduct(U, V) * W.SizeSquared()) / D;
+						Final[t] = Slabs.Contains(Slab, A.X + Offset.X, Offset.Size());
+					}
+
+					// Local face adjacency
+					TArray<int32> Neighbors;
+					Neighbors.Init(-1, NumTetrahedra * 4);
+
+					{
+						TMap<FIntVector, int32> OpenFaces;
+						OpenFaces.Reserve(NumTetrahedra * 2);
+
+						for (int32 t = 0; t < NumTetrahedra; t++)
+						{
+							for (int32 f = 0; f < 4; f++)
+							{
+								const FIntVector Key = GetFaceKey(Tetrahedra[t], f);
+								if (int32 Other = -1; OpenFaces.RemoveAndCopyValue(Key, Other))
+								{
+									Neighbors[t * 4 + f] = Other / 4;
+									Neighbors[Other] = t;
+								}
+								else
+								{
+									OpenFaces.Add(Key, t * 4 + f);
+								}
+							}
+						}
+					}
+
+					TArray<FIntVector4>& OutSlabTetrahedra = SlabTetrahedra[Slab];
+					TArray<FSeamFace>& OutSeamFaces = SeamFaces[Slab];
+					OutSlabTetrahedra.Reserve(NumTetrahedra);
+
+					for (int32 t = 0; t < NumTetrahedra; t++)
+					{
+						const FIntVector4& Tetrahedron = Tetrahedra[t];
+
+						if (!Final[t])
+						{
+							for (int32 k = 0; k < 4; k++) { IsBorder[Tetrahedron[k]] = 1; }
+							continue;
+						}
+
+						OutSlabTetrahedra.Add(Tetrahedron);
+
+						for (int32 f = 0; f < 4; f++)
+						{
+							const int32 Neighbor = Neighbors[t * 4 + f];
+							if (Neighbor != -1 && Final[Neighbor]) { continue; }
+
+							const FIntVector Face = GetFaceKey(Tetrahedron, f);
+							OutSeamFaces.Add(FSeamFace{Face, Tetrahedron[3 - f]});
+
+							// Slab hull, what lies beyond is only known to the seam tetrahedralization
+							if (Neighbor == -1)
+							{
+								IsBorder[Face.X] = 1;
+								IsBorder[Face.Y] = 1;
+								IsBorder[Face.Z] = 1;
+							}
+						}
+					}
+				});
+
+			if (bFailed) { return false; }
+
+			TArray<int32> Border;
+			PCGExArrayHelpers::ArrayOfIndices(Border, IsBorder, 0);
+			IsBorder.Empty();
+
+			const int32 NumBorder = Border.Num();
+			if (NumBorder < 4 || NumBorder > NumPoints / 2) { return false; }
+
+			TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay3D::StitchSeams);
+
+			TArray<FVector> BorderPositions;
+			BorderPositions.SetNumUninitialized(NumBorder);
+			for (int32 i = 0; i < NumBorder; i++) { BorderPositions[i] = Positions[Border[i]]; }
+
+			UE::Geometry::FDelaunay3 Seam;
+			if (!Seam.Triangulate(BorderPositions)) { return false; }
+
+			TArray<FIntVector4> SeamTetrahedra = Seam.GetTetrahedra();
+			BorderPositions.Empty();
+
+			const int32 NumSeamTetrahedra = SeamTetrahedra.Num();
+
+			TMap<FIntVector, FIntPoint> FaceMap;
+			FaceMap.Reserve(NumSeamTetrahedra * 2);
+
+			for (int32 t = 0; t < NumSeamTetrahedra; t++)
+			{
+				FIntVector4& Tetrahedron = SeamTetrahedra[t];
+				for (int32 k = 0; k < 4; k++) { Tetrahedron[k] = Border[Tetrahedron[k]]; }
+
+				for (int32 f = 0; f < 4; f++)
+				{
+					const FIntVector Key = GetFaceKey(Tetrahedron, f);
+					if (FIntPoint* Pair = FaceMap.Find(Key)) { Pair->Y = t; }
+					else { FaceMap.Add(Key, FIntPoint(t, -1)); }
+				}
+			}
+
+			TSet<FIntVector> Blocked;
+			TBitArray<> Covered;
+			Covered.Init(false, NumSeamTetrahedra);
+			TArray<int32> Stack;
+
+			for (const TArray<FSeamFace>& SlabSeamFaces : SeamFaces)
+			{
+				for (const FSeamFace& SeamFace : SlabSeamFaces)
+				{
+					const FIntPoint* Pair = FaceMap.Find(SeamFace.Face);
+
+					// Co-circular points were resolved differently on each side
+					if (!Pair) { return false; }
+
+					Blocked.Add(SeamFace.Face);
+
+					const double Side = Orient(Positions, SeamFace.Face, SeamFace.Opposite);
+					if (Side == 0) { return false; }
+
+					for (const int32 T : {Pair->X, Pair->Y})
+					{
+						if (T == -1 || Covered[T]) { continue; }
+
+						const FIntVector4& Tetrahedron = SeamTetrahedra[T];
+						int32 Apex = -1;
+						for (int32 k = 0; k < 4 && Apex == -1; k++)
+						{
+							const int32 V = Tetrahedron[k];
+							if (V != SeamFace.Face.X && V != SeamFace.Face.Y && V != SeamFace.Face.Z) { Apex = V; }
+						}
+
+						if (Apex == -1 || (Orient(Positions, SeamFace.Face, Apex) > 0) != (Side > 0)) { continue; }
+
+						Covered[T] = true;
+						Stack.Add(T);
+					}
+				}
+			}
+
+			SeamFaces.Empty();
+
+			while (!Stack.IsEmpty())
+			{
+				const int32 T = Stack.Pop(EAllowShrinking::No);
+
+				for (int32 f = 0; f < 4; f++)
+				{
+					const FIntVector Key = GetFaceKey(SeamTetrahedra[T], f);
+					if (Blocked.Contains(Key)) { continue; }
+
+					const FIntPoint& Pair = FaceMap[Key];
+					const int32 Other = Pair.X == T ? Pair.Y : Pair.X;
+					if (Other == -1 || Covered[Other]) { continue; }
+
+					Covered[Other] = true;
+					Stack.Add(Other);
+				}
+			}
+
+			int32 NumTetrahedra = NumSeamTetrahedra;
+			for (const TArray<FIntVector4>& Tetrahedra : SlabTetrahedra) { NumTetrahedra += Tetrahedra.Num(); }
+
+			OutTetrahedra.Reset(NumTetrahedra);
+			for (TArray<FIntVector4>& Tetrahedra : SlabTetrahedra)
+			{
+				OutTetrahedra.Append(Tetrahedra);
+				Tetrahedra.Empty();
+			}
+
+			for (int32 t = 0; t < NumSeamTetrahedra; t++) { if (!Covered[t]) { OutTetrahedra.Add(SeamTetrahedra[t]); } }
+
+			return true;
+		}
+	}
+
 	FDelaunaySite2::FDelaunaySite2(const UE::Geometry::FIndex3i& InVtx, const UE::Geometry::FIndex3i& InAdjacency, const int32 InId)
 		: Id(InId)
 	{
@@ -107,26 +670,56 @@ namespace PCGExMath::Geo
 				std::vector<double> OutVector(Positions.Num() * 2);
 				ProjectionDetails.Project(Positions, OutVector);
 
-				delaunator::Delaunator d(OutVector);
+				if (DelaunayTiling::FTiledTriangulation2 Tiled; DelaunayTiling::IsEnabled(Positions.Num()) && DelaunayTiling::TriangulateTiled2(OutVector, Tiled))
+				{
+					int32 NumTriangles = Tiled.SeamTriangles.Num();
+					for (const TArray<int32>& Triangles : Tiled.SlabTriangles) { NumTriangles += Triangles.Num(); }
 
-				if (d.runtime_error) { return false; }
+					const int32 NumSites = NumTriangles / 3;
+					DelaunayEdges.Reserve(NumSites);
+					Sites.Reserve(NumSites);
+					EdgeMap.Reserve(NumSites);
 
-				const int32 NumTriangles = d.triangles.size();
+					int32 s = 0;
+					auto PushTriangles = [&](TArray<int32>& Triangles)
+					{
+						for (int32 i = 0; i < Triangles.Num(); i += 3)
+						{
+							FDelaunaySite2& Site = Sites.Emplace_GetRef(Triangles[i], Triangles[i + 1], Triangles[i + 2], s++);
+							PushEdge(Site, Site.AB());
+							PushEdge(Site, Site.BC());
+							PushEdge(Site, Site.AC());
+						}
 
-				if (!NumTriangles) { return false; }
+						Triangles.Empty();
+					};
 
-				const int32 NumSites = NumTriangles / 3;
-				DelaunayEdges.Reserve(NumSites);
-				Sites.Reserve(NumSites);
-				EdgeMap.Reserve(NumSites);
-
-				int32 s = 0;
-				for (std::size_t i = 0; i < NumTriangles; i += 3)
+					for (TArray<int32>& Triangles : Tiled.SlabTriangles) { PushTriangles(Triangles); }
+					PushTriangles(Tiled.SeamTriangles);
+				}
+				else
 				{
-					FDelaunaySite2& Site = Sites.Emplace_GetRef(d.triangles[i], d.triangles[i + 1], d.triangles[i + 2], s++);
-					PushEdge(Site, Site.AB());
-					PushEdge(Site, Site.BC());
-					PushEdge(Site, Site.AC());
+					delaunator::Delaunator d(OutVector);
+
+					if (d.runtime_error) { return false; }
+
+					const int32 NumTriangles = d.triangles.size();
+
+					if (!NumTriangles) { return false; }
+
+					const int32 NumSites = NumTriangles / 3;
+					DelaunayEdges.Reserve(NumSites);
+					Sites.Reserve(NumSites);
+					EdgeMap.Reserve(NumSites);
+
+					int32 s = 0;
+					for (std::size_t i = 0; i < NumTriangles; i += 3)
+					{
+						FDelaunaySite2& Site = Sites.Emplace_GetRef(d.triangles[i], d.triangles[i + 1], d.triangles[i + 2], s++);
+						PushEdge(Site, Site.AB());
+						PushEdge(Site, Site.BC());
+						PushEdge(Site, Site.AC());
+					}
 				}
 			}
 			else
@@ -193,6 +786,133 @@ namespace PCGExMath::Geo
 		return IsValid;
 	}
 
+	bool TDelaunay2::ProcessEdges(const TArrayView<FVector>& Positions, const FPCGExGeo2DProjectionDetails& ProjectionDetails)
+	{
+		Clear();
+
+		if (const int32 NumPositions = Positions.Num(); Positions.IsEmpty() || NumPositions <= 2) { return false; }
+
+		TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay2D::ProcessEdges);
+
+		if (PCGEX_CORE_SETTINGS.bUseDelaunator)
+		{
+			std::vector<double> OutVector(Positions.Num() * 2);
+			ProjectionDetails.Project(Positions, OutVector);
+
+			if (DelaunayTiling::FTiledTriangulation2 Tiled; DelaunayTiling::IsEnabled(Positions.Num()) && DelaunayTiling::TriangulateTiled2(OutVector, Tiled))
+			{
+				// Slab triangles are turned into edges in parallel and released right away
+				const int32 NumSlabs = Tiled.SlabTriangles.Num();
+				TArray<TSet<uint64>> SlabEdges;
+				SlabEdges.SetNum(NumSlabs);
+
+				ParallelFor(
+					NumSlabs, [&](const int32 Slab)
+					{
+						TArray<int32>& Triangles = Tiled.SlabTriangles[Slab];
+						TSet<uint64>& Edges = SlabEdges[Slab];
+						Edges.Reserve(Triangles.Num());
+
+						for (int32 i = 0; i < Triangles.Num(); i += 3)
+						{
+							Edges.Add(PCGEx::H64U(Triangles[i], Triangles[i + 1]));
+							Edges.Add(PCGEx::H64U(Triangles[i + 1], Triangles[i + 2]));
+							Edges.Add(PCGEx::H64U(Triangles[i], Triangles[i + 2]));
+						}
+
+						Triangles.Empty();
+					});
+
+				int32 NumEdges = Tiled.SeamTriangles.Num();
+				for (const TSet<uint64>& Edges : SlabEdges) { NumEdges += Edges.Num(); }
+				DelaunayEdges.Reserve(NumEdges);
+
+				for (TSet<uint64>& Edges : SlabEdges)
+				{
+					DelaunayEdges.Append(Edges);
+					Edges.Empty();
+				}
+
+				const TArray<int32>& Triangles = Tiled.SeamTriangles;
+				for (int32 i = 0; i < Triangles.Num(); i += 3)
+				{
+					DelaunayEdges.Add(PCGEx::H64U(Triangles[i], Triangles[i + 1]));
+					DelaunayEdges.Add(PCGEx::H64U(Triangles[i + 1], Triangles[i + 2]));
+					DelaunayEdges.Add(PCGEx::H64U(Triangles[i], Triangles[i + 2]));
+				}
+
+				DelaunayHull.Append(Tiled.Hull);
+			}
+			else
+			{
+				delaunator::Delaunator d(OutVector);
+
+				if (d.runtime_error || d.triangles.empty()) { return false; }
+
+				// Half-edges come in pairs, only keep one side of each
+				const std::size_t NumHalfEdges = d.triangles.size();
+				DelaunayEdges.Reserve(NumHalfEdges / 2 + 1);
+
+				for (std::size_t e = 0; e < NumHalfEdges; e++)
+				{
+					const std::size_t Opposite = d.halfedges[e];
+					if (Opposite != delaunator::INVALID_INDEX && Opposite < e) { continue; }
+					DelaunayEdges.Add(PCGEx::H64U(static_cast<uint32>(d.triangles[e]), static_cast<uint32>(d.triangles[DelaunayTiling::NextHalfEdge(e)])));
+				}
+
+				std::size_t H = d.hull_start;
+				do
+				{
+					DelaunayHull.Add(static_cast<int32>(H));
+					H = d.hull_next[H];
+				}
+				while (H != d.hull_start);
+			}
+		}
+		else
+		{
+			TArray<FVector2D> OutVector;
+			ProjectionDetails.Project(Positions, OutVector);
+
+			UE::Geometry::FDelaunay2 Delaunay2;
+			if (!Delaunay2.Triangulate(OutVector)) { return false; }
+
+			TArray<UE::Geometry::FIndex3i> Triangles = Delaunay2.GetTriangles();
+			if (Triangles.IsEmpty()) { return false; }
+
+			// Edges used by a single triangle are hull edges
+			TSet<uint64> OpenEdges;
+			DelaunayEdges.Reserve(Triangles.Num() * 3 / 2 + 1);
+
+			auto PushEdge = [&](const int32 A, const int32 B)
+			{
+				const uint64 Edge = PCGEx::H64U(A, B);
+				bool bIsAlreadySet = false;
+				DelaunayEdges.Add(Edge, &bIsAlreadySet);
+				if (bIsAlreadySet) { OpenEdges.Remove(Edge); }
+				else { OpenEdges.Add(Edge); }
+			};
+
+			for (const UE::Geometry::FIndex3i& T : Triangles)
+			{
+				PushEdge(T.A, T.B);
+				PushEdge(T.B, T.C);
+				PushEdge(T.A, T.C);
+			}
+
+			for (const uint64 Edge : OpenEdges)
+			{
+				DelaunayHull.Add(PCGEx::H64A(Edge));
+				DelaunayHull.Add(PCGEx::H64B(Edge));
+			}
+		}
+
+		DelaunayEdges.Shrink();
+		IsValid = true;
+
+		return IsValid;
+	}
+
 	void TDelaunay2::RemoveLongestEdges(const TArrayView<FVector>& Positions)
 	{
 		uint64 Edge;
@@ -280,6 +1000,19 @@ namespace PCGExMath::Geo
 		IsValid = false;
 	}
 
+	bool TDelaunay3::Tetrahedralize(const TArrayView<FVector>& Positions, TArray<FIntVector4>& OutTetrahedra) const
+	{
+		if (DelaunayTiling::IsEnabled(Positions.Num()) && DelaunayTiling::TetrahedralizeTiled(Positions, OutTetrahedra)) { return true; }
+
+		OutTetrahedra.Reset();
+
+		UE::Geometry::FDelaunay3 Tetrahedralization;
+		if (!Tetrahedralization.Triangulate(Positions)) { return false; }
+
+		OutTetrahedra = Tetrahedralization.GetTetrahedra();
+		return true;
+	}
+
 	void TDelaunay3::RemoveLongestEdges(const TArrayView<FVector>& Positions)
 	{
 		uint64 Edge;
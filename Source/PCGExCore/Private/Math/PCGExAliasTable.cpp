@@ -0,0 +1,70 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Math/PCGExAliasTable.h"
+
+namespace PCGExMath
+{
+	void FAliasTable::Build(const TConstArrayView<int32> InWeights)
+	{
+		Reset();
+
+		const int32 NumWeights = InWeights.Num();
+		if (!NumWeights) { return; }
+
+		Probabilities.SetNumUninitialized(NumWeights);
+		Aliases.SetNumUninitialized(NumWeights);
+
+		double WeightSum = 0;
+		for (const int32 Weight : InWeights) { WeightSum += FMath::Max(0, Weight); }
+
+		if (WeightSum <= 0)
+		{
+			for (int32 i = 0; i < NumWeights; i++)
+			{
+				Probabilities[i] = 1;
+				Aliases[i] = i;
+			}
+			return;
+		}
+
+		// Scale weights so the average is 1, then pair under-full columns with over-full ones
+		const double Scale = NumWeights / WeightSum;
+
+		TArray<int32> Small;
+		TArray<int32> Large;
+		Small.Reserve(NumWeights);
+		Large.Reserve(NumWeights);
+
+		for (int32 i = 0; i < NumWeights; i++)
+		{
+			Probabilities[i] = FMath::Max(0, InWeights[i]) * Scale;
+			Aliases[i] = i;
+
+			if (Probabilities[i] < 1) { Small.Add(i); }
+			else { Large.Add(i); }
+		}
+
+		while (!Small.IsEmpty() && !Large.IsEmpty())
+		{
+			const int32 Less = Small.Pop(EAllowShrinking::No);
+			const int32 More = Large.Pop(EAllowShrinking::No);
+
+			Aliases[Less] = More;
+			Probabilities[More] = (Probabilities[More] + Probabilities[Less]) - 1;
+
+			if (Probabilities[More] < 1) { Small.Add(More); }
+			else { Large.Add(More); }
+		}
+
+		// Leftovers are only off by floating point error
+		for (const int32 i : Small) { Probabilities[i] = 1; }
+		for (const int32 i : Large) { Probabilities[i] = 1; }
+	}
+
+	void FAliasTable::Reset()
+	{
+		Probabilities.Reset();
+		Aliases.Reset();
+	}
+}
@@ -0,0 +1,115 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Math/PCGExBarnesHutTree.h"
+
+namespace PCGExMath
+{
+	namespace BarnesHut
+	{
+		// Past this depth, remaining items are (nearly) collocated and simply kept in a single leaf
+		constexpr int32 MaxDepth = 24;
+	}
+
+	void FBarnesHutTree::Build(const TConstArrayView<FVector> InPositions, const int32 InLeafSize)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FBarnesHutTree::Build);
+
+		Reset();
+
+		const int32 NumItems = InPositions.Num();
+		if (!NumItems) { return; }
+
+		LeafSize = FMath::Max(1, InLeafSize);
+
+		Items.SetNumUninitialized(NumItems);
+		Positions.SetNumUninitialized(NumItems);
+
+		FBox Bounds(ForceInit);
+		for (int32 i = 0; i < NumItems; i++)
+		{
+			Items[i] = i;
+			Bounds += InPositions[i];
+		}
+
+		Nodes.Reserve(FMath::Max(1, (NumItems / LeafSize) * 2));
+
+		FNode& Root = Nodes.Emplace_GetRef();
+		Root.Center = Bounds.GetCenter();
+		Root.Size = FMath::Max(Bounds.GetSize().GetMax(), UE_KINDA_SMALL_NUMBER);
+		Root.Start = 0;
+		Root.Count = NumItems;
+
+		// Positions are written in item order once the hierarchy is settled; meanwhile use them as partition source
+		for (int32 i = 0; i < NumItems; i++) { Positions[i] = InPositions[i]; }
+
+		TArray<int32> Scratch;
+		Scratch.SetNumUninitialized(NumItems);
+
+		BuildNode(0, 0, Scratch);
+
+		for (int32 i = 0; i < NumItems; i++) { Positions[i] = InPositions[Items[i]]; }
+	}
+
+	void FBarnesHutTree::BuildNode(const int32 NodeIndex, const int32 Depth, TArray<int32>& Scratch)
+	{
+		const FNode Node = Nodes[NodeIndex];
+		const int32 End = Node.Start + Node.Count;
+
+		FVector CenterOfMass = FVector::ZeroVector;
+		for (int32 i = Node.Start; i < End; i++) { CenterOfMass += Positions[Items[i]]; }
+		Nodes[NodeIndex].CenterOfMass = CenterOfMass / Node.Count;
+
+		if (Node.Count <= LeafSize || Depth >= BarnesHut::MaxDepth) { return; }
+
+		// Counting sort of the node's items into octants
+		auto GetOctant = [&](const FVector& P)
+		{
+			return (P.X >= Node.Center.X ? 1 : 0) | (P.Y >= Node.Center.Y ? 2 : 0) | (P.Z >= Node.Center.Z ? 4 : 0);
+		};
+
+		int32 Counts[8] = {};
+		for (int32 i = Node.Start; i < End; i++) { Counts[GetOctant(Positions[Items[i]])]++; }
+
+		int32 Offsets[8];
+		int32 Running = Node.Start;
+		for (int32 o = 0; o < 8; o++)
+		{
+			Offsets[o] = Running;
+			Running += Counts[o];
+		}
+
+		for (int32 i = Node.Start; i < End; i++) { Scratch[Offsets[GetOctant(Positions[Items[i]])]++] = Items[i]; }
+		FMemory::Memcpy(Items.GetData() + Node.Start, Scratch.GetData() + Node.Start, Node.Count * sizeof(int32));
+
+		const int32 FirstChild = Nodes.Num();
+		Nodes[NodeIndex].FirstChild = FirstChild;
+		Nodes.AddDefaulted(8);
+
+		const double ChildSize = Node.Size * 0.5;
+		const double Quarter = Node.Size * 0.25;
+
+		int32 ChildStart = Node.Start;
+		for (int32 o = 0; o < 8; o++)
+		{
+			FNode& Child = Nodes[FirstChild + o];
+			Child.Center = Node.Center + FVector(o & 1 ? Quarter : -Quarter, o & 2 ? Quarter : -Quarter, o & 4 ? Quarter : -Quarter);
+			Child.Size = ChildSize;
+			Child.Start = ChildStart;
+			Child.Count = Counts[o];
+			ChildStart += Counts[o];
+		}
+
+		for (int32 o = 0; o < 8; o++)
+		{
+			if (Counts[o]) { BuildNode(FirstChild + o, Depth + 1, Scratch); }
+		}
+	}
+
+	void FBarnesHutTree::Reset()
+	{
+		Nodes.Reset();
+		Positions.Reset();
+		Items.Reset();
+	}
+}
@@ -0,0 +1,114 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Math/PCGExBoxBVH.h"
+
+namespace PCGExMath
+{
+	namespace BoxBVH
+	{
+		// Hoare-style quickselect : partitions Items[Lo..Hi] so that Items[Nth] holds the median center along Axis
+		static void SelectNth(TArray<int32>& Items, const TConstArrayView<FVector> Centers, int32 Lo, int32 Hi, const int32 Nth, const int32 Axis)
+		{
+			while (Hi > Lo)
+			{
+				const double Pivot = Centers[Items[Lo + (Hi - Lo) / 2]][Axis];
+
+				int32 i = Lo;
+				int32 j = Hi;
+
+				while (i <= j)
+				{
+					while (Centers[Items[i]][Axis] < Pivot) { i++; }
+					while (Centers[Items[j]][Axis] > Pivot) { j--; }
+					if (i <= j)
+					{
+						Swap(Items[i], Items[j]);
+						i++;
+						j--;
+					}
+				}
+
+				if (Nth <= j) { Hi = j; }
+				else if (Nth >= i) { Lo = i; }
+				else { return; }
+			}
+		}
+	}
+
+	void FBoxBVH::Build(const TConstArrayView<FBox> InBoxes, const int32 InLeafSize)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FBoxBVH::Build);
+
+		Reset();
+
+		const int32 NumItems = InBoxes.Num();
+		if (!NumItems) { return; }
+
+		const int32 LeafSize = FMath::Max(1, InLeafSize);
+
+		TArray<FVector> Centers;
+		Centers.SetNumUninitialized(NumItems);
+
+		Items.SetNumUninitialized(NumItems);
+		for (int32 i = 0; i < NumItems; i++)
+		{
+			Items[i] = i;
+			Centers[i] = InBoxes[i].GetCenter();
+		}
+
+		Nodes.Reserve(FMath::Max(1, (NumItems / LeafSize) * 2 + 1));
+		Nodes.Emplace(0, NumItems);
+
+		TArray<int32> Stack;
+		Stack.Add(0);
+
+		while (!Stack.IsEmpty())
+		{
+			const int32 NodeIndex = Stack.Pop(EAllowShrinking::No);
+			const int32 Start = Nodes[NodeIndex].Start;
+			const int32 End = Nodes[NodeIndex].End;
+
+			FBox Bounds = FBox(ForceInit);
+			FBox CenterBounds = FBox(ForceInit);
+			for (int32 i = Start; i < End; i++)
+			{
+				Bounds += InBoxes[Items[i]];
+				CenterBounds += Centers[Items[i]];
+			}
+			Nodes[NodeIndex].Bounds = Bounds;
+
+			if (End - Start <= LeafSize) { continue; }
+
+			// Split along the axis where centers spread the most, at the median
+			const FVector Size = CenterBounds.GetSize();
+			const int32 Axis = Size.X >= Size.Y ? (Size.X >= Size.Z ? 0 : 2) : (Size.Y >= Size.Z ? 1 : 2);
+
+			// Fully collocated centers, keep them as a single leaf
+			if (Size[Axis] <= 0) { continue; }
+
+			const int32 Mid = Start + (End - Start) / 2;
+			BoxBVH::SelectNth(Items, Centers, Start, End - 1, Mid, Axis);
+
+			const int32 Left = Nodes.Emplace(Start, Mid);
+			const int32 Right = Nodes.Emplace(Mid, End);
+
+			Nodes[NodeIndex].Left = Left;
+			Nodes[NodeIndex].Right = Right;
+
+			Stack.Add(Right);
+			Stack.Add(Left);
+		}
+
+		// Reorder boxes to match leaf ranges
+		Boxes.SetNumUninitialized(NumItems);
+		for (int32 i = 0; i < NumItems; i++) { Boxes[i] = InBoxes[Items[i]]; }
+	}
+
+	void FBoxBVH::Reset()
+	{
+		Nodes.Reset();
+		Boxes.Reset();
+		Items.Reset();
+	}
+}
@@ -0,0 +1,102 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Math/PCGExKDTree.h"
+
+namespace PCGExMath
+{
+	namespace KDTree
+	{
+		// Hoare-style quickselect : partitions Items[Lo..Hi] so that Items[Nth] holds the median along Axis
+		static void SelectNth(TArray<int32>& Items, const TConstArrayView<FVector> Positions, int32 Lo, int32 Hi, const int32 Nth, const int32 Axis)
+		{
+			while (Hi > Lo)
+			{
+				const double Pivot = Positions[Items[Lo + (Hi - Lo) / 2]][Axis];
+
+				int32 i = Lo;
+				int32 j = Hi;
+
+				while (i <= j)
+				{
+					while (Positions[Items[i]][Axis] < Pivot) { i++; }
+					while (Positions[Items[j]][Axis] > Pivot) { j--; }
+					if (i <= j)
+					{
+						Swap(Items[i], Items[j]);
+						i++;
+						j--;
+					}
+				}
+
+				if (Nth <= j) { Hi = j; }
+				else if (Nth >= i) { Lo = i; }
+				else { return; }
+			}
+		}
+	}
+
+	void FKDTree::Build(const TConstArrayView<FVector> InPositions, const int32 InLeafSize)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FKDTree::Build);
+
+		Reset();
+
+		const int32 NumItems = InPositions.Num();
+		if (!NumItems) { return; }
+
+		const int32 LeafSize = FMath::Max(1, InLeafSize);
+
+		Items.SetNumUninitialized(NumItems);
+		for (int32 i = 0; i < NumItems; i++) { Items[i] = i; }
+
+		Nodes.Reserve(FMath::Max(1, (NumItems / LeafSize) * 2 + 1));
+		Nodes.Emplace(0, NumItems);
+
+		TArray<int32> Stack;
+		Stack.Add(0);
+
+		while (!Stack.IsEmpty())
+		{
+			const int32 NodeIndex = Stack.Pop(EAllowShrinking::No);
+			const int32 Start = Nodes[NodeIndex].Start;
+			const int32 End = Nodes[NodeIndex].End;
+
+			FBox Bounds = FBox(ForceInit);
+			for (int32 i = Start; i < End; i++) { Bounds += InPositions[Items[i]]; }
+			Nodes[NodeIndex].Bounds = Bounds;
+
+			if (End - Start <= LeafSize) { continue; }
+
+			// Split along the largest axis, at the median
+			const FVector Size = Bounds.GetSize();
+			const int32 Axis = Size.X >= Size.Y ? (Size.X >= Size.Z ? 0 : 2) : (Size.Y >= Size.Z ? 1 : 2);
+
+			// Fully collocated range, keep it as a single leaf
+			if (Size[Axis] <= 0) { continue; }
+
+			const int32 Mid = Start + (End - Start) / 2;
+			KDTree::SelectNth(Items, InPositions, Start, End - 1, Mid, Axis);
+
+			const int32 Left = Nodes.Emplace(Start, Mid);
+			const int32 Right = Nodes.Emplace(Mid, End);
+
+			Nodes[NodeIndex].Left = Left;
+			Nodes[NodeIndex].Right = Right;
+
+			Stack.Add(Right);
+			Stack.Add(Left);
+		}
+
+		// Reorder positions to match leaf ranges
+		Positions.SetNumUninitialized(NumItems);
+		for (int32 i = 0; i < NumItems; i++) { Positions[i] = InPositions[Items[i]]; }
+	}
+
+	void FKDTree::Reset()
+	{
+		Nodes.Reset();
+		Positions.Reset();
+		Items.Reset();
+	}
+}
@@ -0,0 +1,54 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Math/PCGExSpatialHashGrid.h"
+
+#include "Sorting/PCGExSortingHelpers.h"
+
+namespace PCGExMath
+{
+	void FSpatialHashGrid::Build(const TConstArrayView<FVector> InPositions, const double InCellSize)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FSpatialHashGrid::Build);
+
+		Reset();
+
+		CellSize = FMath::Max(InCellSize, UE_SMALL_NUMBER);
+		InvCellSize = 1.0 / CellSize;
+
+		const int32 NumItems = InPositions.Num();
+		if (!NumItems) { return; }
+
+		// Sort items by cell so each cell maps to a contiguous run
+		TArray<PCGEx::FIndexKey> Keys;
+		Keys.SetNumUninitialized(NumItems);
+
+		for (int32 i = 0; i < NumItems; i++)
+		{
+			const FIntVector Cell = GetCell(InPositions[i]);
+			Keys[i] = PCGEx::FIndexKey{i, GetCellKey(Cell.X, Cell.Y, Cell.Z)};
+		}
+
+		PCGExSortingHelpers::RadixSort(Keys);
+
+		Items.SetNumUninitialized(NumItems);
+		Cells.Reserve(NumItems / 4);
+
+		int32 RunStart = 0;
+		for (int32 i = 0; i < NumItems; i++)
+		{
+			Items[i] = Keys[i].Index;
+			if (i + 1 == NumItems || Keys[i + 1].Key != Keys[i].Key)
+			{
+				Cells.Add(Keys[i].Key, FIntPoint(RunStart, i + 1 - RunStart));
+				RunStart = i + 1;
+			}
+		}
+	}
+
+	void FSpatialHashGrid::Reset()
+	{
+		Cells.Reset();
+		Items.Reset();
+	}
+}
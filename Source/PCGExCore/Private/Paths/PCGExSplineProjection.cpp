@@ -0,0 +1,222 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Paths/PCGExSplineProjection.h"
+
+#include "Data/PCGSplineStruct.h"
+
+namespace PCGExPaths
+{
+	namespace SplineProjection
+	{
+		constexpr int32 LeafSize = 4;
+
+		struct FCandidate
+		{
+			double DistSquared = 0;
+			int32 Node = -1;
+
+			FCandidate() = default;
+
+			FCandidate(const double InDistSquared, const int32 InNode)
+				: DistSquared(InDistSquared), Node(InNode)
+			{
+			}
+
+			FORCEINLINE bool operator<(const FCandidate& Other) const { return DistSquared < Other.DistSquared; }
+		};
+
+		// Hoare-style quickselect on segment centroids
+		static void SelectNth(TArray<int32>& Segments, const TArray<FVector>& Centroids, int32 Lo, int32 Hi, const int32 Nth, const int32 Axis)
+		{
+			while (Hi > Lo)
+			{
+				const double Pivot = Centroids[Segments[Lo + (Hi - Lo) / 2]][Axis];
+
+				int32 i = Lo;
+				int32 j = Hi;
+
+				while (i <= j)
+				{
+					while (Centroids[Segments[i]][Axis] < Pivot) { i++; }
+					while (Centroids[Segments[j]][Axis] > Pivot) { j--; }
+					if (i <= j)
+					{
+						Swap(Segments[i], Segments[j]);
+						i++;
+						j--;
+					}
+				}
+
+				if (Nth <= j) { Hi = j; }
+				else if (Nth >= i) { Lo = i; }
+				else { return; }
+			}
+		}
+	}
+
+	FSplineProjection::FSplineProjection(const FPCGSplineStruct& InSpline, const int32 InSamplesPerSegment)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FSplineProjection::Build);
+
+		const int32 NumSplineSegments = InSpline.GetNumberOfSplineSegments();
+		if (NumSplineSegments <= 0) { return; }
+
+		Positions = &InSpline.GetSplinePointsPosition();
+		Transform = InSpline.GetTransform();
+		MaxKey = NumSplineSegments;
+
+		// Dense polyline approximation, in local space
+		const int32 SamplesPerSegment = FMath::Max(1, InSamplesPerSegment);
+		const int32 NumSegments = NumSplineSegments * SamplesPerSegment;
+
+		Points.SetNumUninitialized(NumSegments + 1);
+		Keys.SetNumUninitialized(NumSegments + 1);
+
+		for (int32 i = 0; i <= NumSegments; i++)
+		{
+			const double Key = static_cast<double>(i) / SamplesPerSegment;
+			Keys[i] = Key;
+			Points[i] = Positions->Eval(static_cast<float>(Key), FVector::ZeroVector);
+		}
+
+		TArray<FVector> Centroids;
+		Centroids.SetNumUninitialized(NumSegments);
+		Segments.SetNumUninitialized(NumSegments);
+
+		for (int32 i = 0; i < NumSegments; i++)
+		{
+			Segments[i] = i;
+			Centroids[i] = (Points[i] + Points[i + 1]) * 0.5;
+		}
+
+		// Median-split BVH over segments
+		Nodes.Reserve((NumSegments / SplineProjection::LeafSize) * 2 + 1);
+		Nodes.Emplace(0, NumSegments);
+
+		TArray<int32> Stack;
+		Stack.Add(0);
+
+		while (!Stack.IsEmpty())
+		{
+			const int32 NodeIndex = Stack.Pop(EAllowShrinking::No);
+			const int32 Start = Nodes[NodeIndex].Start;
+			const int32 End = Nodes[NodeIndex].End;
+
+			FBox Bounds = FBox(ForceInit);
+			FBox CentroidBounds = FBox(ForceInit);
+
+			for (int32 i = Start; i < End; i++)
+			{
+				const int32 Segment = Segments[i];
+				Bounds += Points[Segment];
+				Bounds += Points[Segment + 1];
+				CentroidBounds += Centroids[Segment];
+			}
+
+			Nodes[NodeIndex].Bounds = Bounds;
+
+			if (End - Start <= SplineProjection::LeafSize) { continue; }
+
+			const FVector Size = CentroidBounds.GetSize();
+			const int32 Axis = Size.X >= Size.Y ? (Size.X >= Size.Z ? 0 : 2) : (Size.Y >= Size.Z ? 1 : 2);
+
+			if (Size[Axis] <= 0) { continue; }
+
+			const int32 Mid = Start + (End - Start) / 2;
+			SplineProjection::SelectNth(Segments, Centroids, Start, End - 1, Mid, Axis);
+
+			const int32 Left = Nodes.Emplace(Start, Mid);
+			const int32 Right = Nodes.Emplace(Mid, End);
+
+			Nodes[NodeIndex].Left = Left;
+			Nodes[NodeIndex].Right = Right;
+
+			Stack.Add(Right);
+			Stack.Add(Left);
+		}
+	}
+
+	double FSplineProjection::FindInputKeyClosestToWorldLocation(const FVector& WorldLocation) const
+	{
+		return FindInputKeyClosestToLocalLocation(Transform.InverseTransformPosition(WorldLocation));
+	}
+
+	double FSplineProjection::FindInputKeyClosestToLocalLocation(const FVector& LocalLocation) const
+	{
+		if (Nodes.IsEmpty()) { return 0; }
+
+		// Bounded best-first search for the closest polyline segment
+
+		int32 BestSegment = -1;
+		double BestKey = 0;
+		double BestDistSquared = MAX_dbl;
+
+		TArray<SplineProjection::FCandidate, TInlineAllocator<64>> Heap;
+		Heap.HeapPush(SplineProjection::FCandidate(0, 0));
+
+		SplineProjection::FCandidate Candidate;
+		while (!Heap.IsEmpty())
+		{
+			Heap.HeapPop(Candidate, EAllowShrinking::No);
+			if (Candidate.DistSquared >= BestDistSquared) { break; }
+
+			const FNode& Node = Nodes[Candidate.Node];
+			if (Node.IsLeaf())
+			{
+				for (int32 i = Node.Start; i < Node.End; i++)
+				{
+					double DistSquared = 0;
+					const double Key = ProjectOnSegment(Segments[i], LocalLocation, DistSquared);
+					if (DistSquared < BestDistSquared)
+					{
+						BestDistSquared = DistSquared;
+						BestKey = Key;
+						BestSegment = Segments[i];
+					}
+				}
+
+				continue;
+			}
+
+			for (const int32 Child : {Node.Left, Node.Right})
+			{
+				if (const double DistSquared = Nodes[Child].Bounds.ComputeSquaredDistanceToPoint(LocalLocation); DistSquared < BestDistSquared)
+				{
+					Heap.HeapPush(SplineProjection::FCandidate(DistSquared, Child));
+				}
+			}
+		}
+
+		if (BestSegment == -1) { return 0; }
+
+		// Single Gauss-Newton refinement on the actual curve, bounded to the neighborhood of the polyline segment
+
+		const double Step = Keys[BestSegment + 1] - Keys[BestSegment];
+		const double MinKey = FMath::Max(0.0, Keys[BestSegment] - Step);
+		const double MaxRefinedKey = FMath::Min(MaxKey, Keys[BestSegment + 1] + Step);
+
+		const FVector Position = Positions->Eval(static_cast<float>(BestKey), FVector::ZeroVector);
+		const FVector Derivative = Positions->EvalDerivative(static_cast<float>(BestKey), FVector::ZeroVector);
+
+		const double DerivativeSquared = Derivative.SizeSquared();
+		if (DerivativeSquared <= UE_SMALL_NUMBER) { return BestKey; }
+
+		const double RefinedKey = FMath::Clamp(BestKey - FVector::DotProduct(Position - LocalLocation, Derivative) / DerivativeSquared, MinKey, MaxRefinedKey);
+		const FVector RefinedPosition = Positions->Eval(static_cast<float>(RefinedKey), FVector::ZeroVector);
+
+		return FVector::DistSquared(RefinedPosition, LocalLocation) < FVector::DistSquared(Position, LocalLocation) ? RefinedKey : BestKey;
+	}
+
+	double FSplineProjection::ProjectOnSegment(const int32 Segment, const FVector& LocalLocation, double& OutDistSquared) const
+	{
+		const FVector& A = Points[Segment];
+		const FVector AB = Points[Segment + 1] - A;
+
+		const double LengthSquared = AB.SizeSquared();
+		const double Alpha = LengthSquared > UE_SMALL_NUMBER ? FMath::Clamp(FVector::DotProduct(LocalLocation - A, AB) / LengthSquared, 0.0, 1.0) : 0.0;
+
+		OutDistSquared = FVector::DistSquared(A + AB * Alpha, LocalLocation);
+		return FMath::Lerp(Keys[Segment], Keys[Segment + 1], Alpha);
+	}
+}
@@ -10,6 +10,7 @@
 #include "Data/PCGExProxyData.h"
 #include "Data/PCGExProxyDataHelpers.h"
 #include "Sorting/PCGExSortingDetails.h"
+#include "Sorting/PCGExSortingHelpers.h"
 #include "Async/ParallelFor.h"
 
 #define LOCTEXT_NAMESPACE "PCGExModularSortPoints"
@@ -283,5 +284,237 @@ namespace PCGExSorting
 		return Cache;
 	}
 
+	namespace SortCache
+	{
+		// Below this, the comparator sort is faster than the key encoding overhead
+		constexpr int32 RadixThreshold = 4096;
+
+		// Largest magnitude a quantized value can have while staying exactly representable
+		constexpr double MaxQuantized = 4503599627370496.0; // 2^52
+
+		FORCEINLINE uint64 EncodeDouble(const double InValue)
+		{
+			// -0.0 and +0.0 compare equal, they must share a key
+			const double Value = InValue == 0 ? 0.0 : InValue;
+
+			uint64 Bits;
+			FMemory::Memcpy(&Bits, &Value, sizeof(uint64));
+			return (Bits & 0x8000000000000000ULL) ? ~Bits : Bits | 0x8000000000000000ULL;
+		}
+
+		FORCEINLINE uint64 EncodeInt64(const int64 InValue)
+		{
+			return static_cast<uint64>(InValue) ^ 0x8000000000000000ULL;
+		}
+
+		struct FRadixRule
+		{
+			const double* Values = nullptr;
+			double InvTolerance = 0;
+			bool bQuantize = false;
+			bool bFlip = false;
+			uint64 Base = 0;
+			int32 Bits = 0;
+			int32 Shift = 0;
+
+			FORCEINLINE uint64 Encode(const int32 Index) const
+			{
+				const double Value = Values[Index];
+				const uint64 Key = bQuantize ? EncodeInt64(static_cast<int64>(FMath::FloorToDouble(Value * InvTolerance))) : EncodeDouble(Value);
+				return bFlip ? ~Key : Key;
+			}
+
+			FORCEINLINE uint64 Pack(const int32 Index) const { return (Encode(Index) - Base) << Shift; }
+		};
+	}
+
+	void FSortCache::Sort(TArray<int32>& InOutOrder) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FSortCache::Sort);
+
+		const int32 NumOrder = InOutOrder.Num();
+		if (NumOrder < SortCache::RadixThreshold)
+		{
+			InOutOrder.Sort([&](const int32 A, const int32 B) { return Compare(A, B); });
+			return;
+		}
+
+		const int32 NumRules = Rules.Num();
+
+		// Encode each rule into an order-preserving key and measure the range it actually spans.
+		// Exact rules use their value, tolerant rules are quantized into tolerance-wide buckets so they can be packed as well.
+
+		TArray<SortCache::FRadixRule> RadixRules;
+		RadixRules.Reserve(NumRules);
+
+		for (const FRuleCache& Rule : Rules)
+		{
+			SortCache::FRadixRule& RadixRule = RadixRules.Emplace_GetRef();
+			RadixRule.Values = Rule.Values.GetData();
+			RadixRule.bFlip = Rule.bInvertRule != bDescending;
+
+			if (Rule.Tolerance > 0)
+			{
+				double MaxAbs = 0;
+				for (const int32 Index : InOutOrder) { MaxAbs = FMath::Max(MaxAbs, FMath::Abs(Rule.Values[Index])); }
+
+				RadixRule.InvTolerance = 1.0 / Rule.Tolerance;
+				RadixRule.bQuantize = MaxAbs * RadixRule.InvTolerance < SortCache::MaxQuantized;
+			}
+
+			uint64 MinKey = MAX_uint64;
+			uint64 MaxKey = 0;
+			for (const int32 Index : InOutOrder)
+			{
+				const uint64 Key = RadixRule.Encode(Index);
+				MinKey = FMath::Min(MinKey, Key);
+				MaxKey = FMath::Max(MaxKey, Key);
+			}
+
+			RadixRule.Base = MinKey;
+			RadixRule.Bits = MinKey == MaxKey ? 0 : 64 - static_cast<int32>(FMath::CountLeadingZeros64(MaxKey - MinKey));
+		}
+
+		// Pack rules into composite keys, most significant rule first
+
+		TArray<TArray<int32>> Words;
+		TArray<int32> WordBits;
+
+		int32 Remaining = 0;
+		for (int32 r = 0; r < RadixRules.Num(); r++)
+		{
+			const int32 Bits = RadixRules[r].Bits;
+			if (!Bits) { continue; }
+
+			if (Words.IsEmpty() || Bits > Remaining)
+			{
+				Words.Emplace();
+				WordBits.Add(0);
+				Remaining = 64;
+			}
+
+			Words.Last().Add(r);
+			WordBits.Last() += Bits;
+			Remaining -= Bits;
+		}
+
+		for (int32 w = 0; w < Words.Num(); w++)
+		{
+			int32 Shift = WordBits[w];
+			for (const int32 r : Words[w])
+			{
+				Shift -= RadixRules[r].Bits;
+				RadixRules[r].Shift = Shift;
+			}
+		}
+
+		// LSD over composite keys, least significant word first
+
+		TArray<PCGEx::FIndexKey> Keys;
+		Keys.SetNumUninitialized(NumOrder);
+
+		for (int32 w = Words.Num() - 1; w >= 0; w--)
+		{
+			const TArray<int32>& WordRules = Words[w];
+
+			PCGEX_PARALLEL_FOR(
+				NumOrder,
+				const int32 Index = InOutOrder[i];
+				uint64 Key = 0;
+				for (const int32 r : WordRules) { Key |= RadixRules[r].Pack(Index); }
+				Keys[i] = PCGEx::FIndexKey{Index, Key};
+			)
+
+			PCGExSortingHelpers::ParallelRadixSort(Keys, WordBits[w]);
+
+			PCGEX_PARALLEL_FOR(
+				NumOrder,
+				InOutOrder[i] = Keys[i].Index;
+			)
+		}
+
+		// Fix-up pass : values within the same bucket are always within tolerance, and buckets two or more apart never are,
+		// so keys only disagree with Compare across two neighboring buckets whose values come within tolerance of each other.
+		// Those groups are merged into ranges that are re-sorted with the full comparator.
+
+		auto FirstDifferingRule = [&](const int32 A, const int32 B)
+		{
+			int32 r = 0;
+			while (r < NumRules && RadixRules[r].Encode(A) == RadixRules[r].Encode(B)) { r++; }
+			return r;
+		};
+
+		TArray<TPair<int32, int32>> Ranges; // [Start, End)
+
+		for (int32 i = 1; i < NumOrder; i++)
+		{
+			const int32 A = InOutOrder[i - 1];
+			const int32 B = InOutOrder[i];
+
+			const int32 r = FirstDifferingRule(A, B);
+			if (r >= NumRules) { continue; }
+
+			const FRuleCache& Rule = Rules[r];
+			const SortCache::FRadixRule& RadixRule = RadixRules[r];
+
+			if (Rule.Tolerance <= 0) { continue; }
+			if (RadixRule.bQuantize)
+			{
+				const uint64 KeyA = RadixRule.Encode(A);
+				const uint64 KeyB = RadixRule.Encode(B);
+				if ((KeyA > KeyB ? KeyA - KeyB : KeyB - KeyA) > 1) { continue; }
+			}
+
+			// Groups on either side of the boundary share every key up to and including rule r
+			int32 Start = i - 1;
+			while (Start > 0 && FirstDifferingRule(InOutOrder[Start - 1], A) > r) { Start--; }
+
+			int32 End = i + 1;
+			while (End < NumOrder && FirstDifferingRule(InOutOrder[End], B) > r) { End++; }
+
+			double MinA = MAX_dbl;
+			double MaxA = -MAX_dbl;
+			for (int32 j = Start; j < i; j++)
+			{
+				MinA = FMath::Min(MinA, Rule.Values[InOutOrder[j]]);
+				MaxA = FMath::Max(MaxA, Rule.Values[InOutOrder[j]]);
+			}
+
+			double MinB = MAX_dbl;
+			double MaxB = -MAX_dbl;
+			for (int32 j = i; j < End; j++)
+			{
+				MinB = FMath::Min(MinB, Rule.Values[InOutOrder[j]]);
+				MaxB = FMath::Max(MaxB, Rule.Values[InOutOrder[j]]);
+			}
+
+			if (FMath::Max(MinB - MaxA, MinA - MaxB) > Rule.Tolerance) { continue; }
+
+			// A coarser group may swallow several ranges found at finer levels
+			while (!Ranges.IsEmpty() && Start <= Ranges.Last().Value)
+			{
+				Start = FMath::Min(Ranges.Last().Key, Start);
+				End = FMath::Max(Ranges.Last().Value, End);
+				Ranges.Pop(EAllowShrinking::No);
+			}
+
+			Ranges.Emplace(Start, End);
+
+			// Anything inside the group past the boundary gets re-sorted anyway, resume at its far edge
+			i = End - 1;
+		}
+
+		ParallelFor(Ranges.Num(), [&](const int32 RangeIndex)
+		{
+			const TPair<int32, int32>& Range = Ranges[RangeIndex];
+			TArrayView<int32> Run(InOutOrder.GetData() + Range.Key, Range.Value - Range.Key);
+			Run.Sort([&](const int32 A, const int32 B) { return Compare(A, B); });
+		});
+	}
+
+			RunStart = i;
+		}
+	}
+
 #pragma endregion
 }
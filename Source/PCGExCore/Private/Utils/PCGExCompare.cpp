@@ -84,6 +84,34 @@ namespace PCGExCompare
 		}
 	}
 
+	void CompareScope(const EPCGExComparison Method, TConstArrayView<double> A, TConstArrayView<double> B, TArrayView<int8> OutResults, const double Tolerance)
+	{
+		const int32 Num = OutResults.Num();
+		check(A.Num() == Num && B.Num() == Num);
+
+		const double* RESTRICT APtr = A.GetData();
+		const double* RESTRICT BPtr = B.GetData();
+		int8* RESTRICT OutPtr = OutResults.GetData();
+
+#define PCGEX_COMPARE_SCOPE(_EXPR) for (int i = 0; i < Num; i++) { const double VA = APtr[i]; const double VB = BPtr[i]; OutPtr[i] &= static_cast<int8>(_EXPR); } break;
+
+		switch (Method)
+		{
+		case EPCGExComparison::StrictlyEqual: PCGEX_COMPARE_SCOPE(VA == VB)
+		case EPCGExComparison::StrictlyNotEqual: PCGEX_COMPARE_SCOPE(VA != VB)
+		case EPCGExComparison::EqualOrGreater: PCGEX_COMPARE_SCOPE(VA >= VB)
+		case EPCGExComparison::EqualOrSmaller: PCGEX_COMPARE_SCOPE(VA <= VB)
+		case EPCGExComparison::StrictlyGreater: PCGEX_COMPARE_SCOPE(VA > VB)
+		case EPCGExComparison::StrictlySmaller: PCGEX_COMPARE_SCOPE(VA < VB)
+		case EPCGExComparison::NearlyEqual: PCGEX_COMPARE_SCOPE(FMath::Abs(VA - VB) <= Tolerance)
+		case EPCGExComparison::NearlyNotEqual: PCGEX_COMPARE_SCOPE(FMath::Abs(VA - VB) > Tolerance)
+		default: for (int i = 0; i < Num; i++) { OutPtr[i] = 0; }
+			break;
+		}
+
+#undef PCGEX_COMPARE_SCOPE
+	}
+
 	bool Compare(const EPCGExComparison Method, const TSharedPtr<PCGExData::IDataValue>& A, const double B, const double Tolerance)
 	{
 		if (!A->IsNumeric()) { return false; }
@@ -246,6 +274,42 @@ bool FPCGExDotComparisonDetails::Test(const double A, const int32 Index) const
 	return Test(A, GetComparisonThreshold(Index));
 }
 
+void FPCGExDotComparisonDetails::TestScope(const int32 Start, TConstArrayView<double> Dots, TArrayView<int8> OutResults) const
+{
+	const int32 Num = Dots.Num();
+
+	TArray<double> A;
+	TArray<double> B;
+	A.SetNumUninitialized(Num);
+	B.SetNumUninitialized(Num);
+
+	ThresholdGetter->ReadScope(Start, B);
+
+	if (Domain == EPCGExAngularDomain::Degrees)
+	{
+		for (int i = 0; i < Num; i++) { B[i] = PCGExMath::DegreesToDot(180 - B[i]); }
+	}
+
+	if (bUnsignedComparison)
+	{
+		for (int i = 0; i < Num; i++)
+		{
+			A[i] = FMath::Abs(Dots[i]);
+			B[i] = FMath::Abs(B[i]);
+		}
+	}
+	else
+	{
+		for (int i = 0; i < Num; i++)
+		{
+			A[i] = (1 + Dots[i]) * 0.5;
+			B[i] = (1 + B[i]) * 0.5;
+		}
+	}
+
+	PCGExCompare::CompareScope(Comparison, A, B, OutResults, ComparisonTolerance);
+}
+
 void FPCGExDotComparisonDetails::RegisterBuffersDependencies(FPCGExContext* InContext, PCGExData::FFacadePreloader& FacadePreloader) const
 {
 	if (ThresholdInput == EPCGExInputValueType::Attribute) { FacadePreloader.Register<double>(InContext, ThresholdAttribute); }
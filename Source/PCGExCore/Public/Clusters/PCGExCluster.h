@@ -3,9 +3,12 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "CoreMinimal.h"
 #include "PCGExEdge.h"
 #include "PCGExNode.h"
+#include "PCGExClusterCSR.h"
 #include "PCGExClusterCommon.h"
 #include "PCGExOctree.h"
 #include "Containers/PCGExIndexLookup.h"
@@ -87,6 +90,9 @@ namespace PCGExClusters
 		TSharedPtr<PCGExOctree::FItemOctree> NodeOctree;
 		TSharedPtr<PCGExOctree::FItemOctree> EdgeOctree;
 
+		TSharedPtr<FClusterCSR> CSR; // Optional packed adjacency, see GetCSR. Owned here, only assigned under ClusterLock.
+		std::atomic<const FClusterCSR*> PackedLinks{nullptr}; // Lock-free view of CSR for hot accessors; published with release once CSR is fully built
+
 		FCluster(const TSharedPtr<PCGExData::FPointIO>& InVtxIO, const TSharedPtr<PCGExData::FPointIO>& InEdgesIO, const TSharedPtr<PCGEx::FIndexLookup>& InNodeIndexLookup);
 		FCluster(const TSharedRef<FCluster>& OtherCluster, const TSharedPtr<PCGExData::FPointIO>& InVtxIO, const TSharedPtr<PCGExData::FPointIO>& InEdgesIO, const TSharedPtr<PCGEx::FIndexLookup>& InNodeIndexLookup, bool bCopyNodes, bool bCopyEdges, bool bCopyLookup);
 
@@ -151,8 +157,24 @@ namespace PCGExClusters
 		FORCEINLINE FNode* GetEdgeEnd(const FEdge* InEdge) const { return (NodesDataPtr + NodeIndexLookup->Get(InEdge->End)); }
 		FORCEINLINE FNode* GetEdgeEnd(const FEdge& InEdge) const { return (NodesDataPtr + NodeIndexLookup->Get(InEdge.End)); }
 		FORCEINLINE FNode* GetEdgeEnd(const int32 InEdgeIndex) const { return (NodesDataPtr + NodeIndexLookup->Get((EdgesDataPtr + InEdgeIndex)->End)); }
-		FORCEINLINE FNode* GetEdgeOtherNode(const int32 InEdgeIndex, const int32 InNodeIndex) const { return (NodesDataPtr + NodeIndexLookup->Get((EdgesDataPtr + InEdgeIndex)->Other((NodesDataPtr + InNodeIndex)->PointIndex))); }
-		FORCEINLINE FNode* GetEdgeOtherNode(const FLink Lk) const { return (NodesDataPtr + NodeIndexLookup->Get((EdgesDataPtr + Lk.Edge)->Other((NodesDataPtr + Lk.Node)->PointIndex))); }
+		FORCEINLINE FNode* GetEdgeOtherNode(const int32 InEdgeIndex, const int32 InNodeIndex) const
+		{
+			if (const FClusterCSR* Packed = PackedLinks.load(std::memory_order_acquire)) { return (NodesDataPtr + Packed->GetEdgeOtherNode(InEdgeIndex, InNodeIndex)); }
+			return (NodesDataPtr + NodeIndexLookup->Get((EdgesDataPtr + InEdgeIndex)->Other((NodesDataPtr + InNodeIndex)->PointIndex)));
+		}
+
+		FORCEINLINE FNode* GetEdgeOtherNode(const FLink Lk) const
+		{
+			if (const FClusterCSR* Packed = PackedLinks.load(std::memory_order_acquire)) { return (NodesDataPtr + Packed->GetEdgeOtherNode(Lk.Edge, Lk.Node)); }
+			return (NodesDataPtr + NodeIndexLookup->Get((EdgesDataPtr + Lk.Edge)->Other((NodesDataPtr + Lk.Node)->PointIndex)));
+		}
+
+		/** Node links, read from the packed CSR layout when it has been built */
+		FORCEINLINE TConstArrayView<FLink> GetLinks(const int32 NodeIndex) const
+		{
+			if (const FClusterCSR* Packed = PackedLinks.load(std::memory_order_acquire)) { return Packed->GetLinks(NodeIndex); }
+			return TConstArrayView<FLink>((NodesDataPtr + NodeIndex)->Links);
+		}
 
 		FORCEINLINE FVector GetStartPos(const FEdge& InEdge) const { return VtxTransforms[InEdge.Start].GetLocation(); }
 		FORCEINLINE FVector GetStartPos(const FEdge* InEdge) const { return VtxTransforms[InEdge->Start].GetLocation(); }
@@ -232,16 +254,23 @@ namespace PCGExClusters
 		int32 FindClosestNeighborInDirection(const int32 NodeIndex, const FVector& Direction, int32 MinNeighborCount = 1) const;
 
 		TSharedPtr<TArray<FBoundedEdge>> GetBoundedEdges(const bool bBuild);
+
+		/**
+		 * Build (once) and return the packed CSR adjacency.
+		 * Once built, GetLinks, GrabNeighbors & GetEdgeOtherNode read from it instead of the per-node link arrays.
+		 */
+		TSharedPtr<FClusterCSR> GetCSR();
 		void ExpandEdges(PCGExMT::FTaskManager* TaskManager);
 
 		template <typename T, class MakeFunc>
 		void GrabNeighbors(const int32 NodeIndex, TArray<T>& OutNeighbors, const MakeFunc&& Make) const
 		{
 			FNode* Node = (NodesDataPtr + NodeIndex);
-			PCGExArrayHelpers::InitArray(OutNeighbors, Node->Num());
-			for (int i = 0; i < Node->Num(); i++)
+			const TConstArrayView<FLink> NodeLinks = GetLinks(NodeIndex);
+			PCGExArrayHelpers::InitArray(OutNeighbors, NodeLinks.Num());
+			for (int i = 0; i < NodeLinks.Num(); i++)
 			{
-				const FLink Lk = Node->Links[i];
+				const FLink Lk = NodeLinks[i];
 				OutNeighbors[i] = Make(Node, (NodesDataPtr + Lk.Node), (EdgesDataPtr + Lk.Edge));
 			}
 		}
@@ -249,10 +278,11 @@ namespace PCGExClusters
 		template <typename T, class MakeFunc>
 		void GrabNeighbors(const FNode& Node, TArray<T>& OutNeighbors, const MakeFunc&& Make) const
 		{
-			PCGExArrayHelpers::InitArray(OutNeighbors, Node.Num());
-			for (int i = 0; i < Node.Num(); i++)
+			const TConstArrayView<FLink> NodeLinks = GetLinks(Node.Index);
+			PCGExArrayHelpers::InitArray(OutNeighbors, NodeLinks.Num());
+			for (int i = 0; i < NodeLinks.Num(); i++)
 			{
-				const FLink Lk = Node.Links[i];
+				const FLink Lk = NodeLinks[i];
 				OutNeighbors[i] = Make((NodesDataPtr + Lk.Node), (EdgesDataPtr + Lk.Edge));
 			}
 		}
@@ -0,0 +1,51 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGExLink.h"
+
+namespace PCGExClusters
+{
+	class FCluster;
+
+	/**
+	 * Compressed sparse row layout of a cluster's adjacency.
+	 * All links are packed in a single contiguous array indexed by per-node offsets, and edge endpoints are resolved
+	 * to node indices up-front so traversals don't hop between scattered FNode records or hash lookups.
+	 * Links are immutable once a cluster is built, so this stays valid for the lifetime of the cluster.
+	 * This is an acceleration structure on top of FNode::Links, not a replacement: it costs 4 bytes per node and 24 per edge.
+	 */
+	class PCGEXCORE_API FClusterCSR : public TSharedFromThis<FClusterCSR>
+	{
+	public:
+		TArray<int32> Offsets;      // Node index -> first link, NumNodes + 1 entries
+		TArray<PCGExGraphs::FLink> Links;
+		TArray<int32> EdgeNodes;    // Edge index * 2 -> Start node index, Edge index * 2 + 1 -> End node index
+
+		FClusterCSR() = default;
+
+		void Build(const FCluster* InCluster);
+
+		FORCEINLINE int32 NumNodes() const { return FMath::Max(0, Offsets.Num() - 1); }
+		FORCEINLINE int32 NumLinks(const int32 NodeIndex) const { return Offsets[NodeIndex + 1] - Offsets[NodeIndex]; }
+
+		FORCEINLINE TConstArrayView<PCGExGraphs::FLink> GetLinks(const int32 NodeIndex) const
+		{
+			const int32 Start = Offsets[NodeIndex];
+			return TConstArrayView<PCGExGraphs::FLink>(Links.GetData() + Start, Offsets[NodeIndex + 1] - Start);
+		}
+
+		FORCEINLINE int32 GetEdgeStartNode(const int32 EdgeIndex) const { return EdgeNodes[EdgeIndex * 2]; }
+		FORCEINLINE int32 GetEdgeEndNode(const int32 EdgeIndex) const { return EdgeNodes[EdgeIndex * 2 + 1]; }
+
+		FORCEINLINE int32 GetEdgeOtherNode(const int32 EdgeIndex, const int32 NodeIndex) const
+		{
+			const int32 Start = EdgeNodes[EdgeIndex * 2];
+			return Start == NodeIndex ? EdgeNodes[EdgeIndex * 2 + 1] : Start;
+		}
+
+		SIZE_T GetAllocatedSize() const;
+	};
+}
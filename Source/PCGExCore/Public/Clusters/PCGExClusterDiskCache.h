@@ -0,0 +1,53 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExData
+{
+	class FPointIO;
+}
+
+namespace PCGExClusters
+{
+	class FCluster;
+}
+
+/**
+ * Persistent, on-disk cluster cache.
+ * Blobs are named after a short key (CRC of the vtx & edge endpoint attributes), and store a full 128bit hash of
+ * vtx positions & edge endpoints that must match before anything is loaded. Blobs are fully validated before the
+ * cluster is touched, so a corrupt or truncated file only ever results in a regular rebuild.
+ * Octrees & edge lengths are left to be lazily rebuilt as usual.
+ */
+namespace PCGExClusters::DiskCache
+{
+	struct PCGEXCORE_API FKey
+	{
+		uint64 Id = 0;       // File name
+		uint64 HashLow = 0;  // Full content hash, verified on load
+		uint64 HashHigh = 0;
+
+		FORCEINLINE bool IsValid() const { return Id != 0; }
+	};
+
+	/** Whether the persistent cache is enabled and worth using for the given amount of vtx */
+	PCGEXCORE_API bool IsEnabled(const int32 NumVtx);
+
+	/** Compute the key of a vtx/edges pair. Returns an invalid key if it could not be computed. */
+	PCGEXCORE_API FKey ComputeKey(const TSharedRef<PCGExData::FPointIO>& VtxIO, const TSharedRef<PCGExData::FPointIO>& EdgesIO);
+
+	PCGEXCORE_API FString GetCacheDirectory();
+	PCGEXCORE_API FString GetCachePath(const uint64 Id);
+
+	/**
+	 * Memory-map the blob associated with the key and populate a freshly created cluster from it.
+	 * Returns false without blocking if too many cache reads/writes are already in flight.
+	 */
+	PCGEXCORE_API bool TryLoad(const TSharedRef<FCluster>& InCluster, const FKey& Key);
+
+	/** Write a built cluster to disk, then evict least recently used blobs above the size cap. Safe to call concurrently for the same key. */
+	PCGEXCORE_API bool Save(const TSharedRef<FCluster>& InCluster, const FKey& Key);
+}
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "PCGExStampedArray.h"
 
 namespace PCGEx
 {
@@ -70,6 +71,27 @@ namespace PCGEx
 		FORCEINLINE bool Contains(const int32 Index) const { return Data.Contains(Index); }
 	};
 
+	/**
+	 * Array lookup with generation-stamped entries; Reset is O(1), making it suitable for
+	 * structures that are reset between many short-lived queries.
+	 */
+	class FHashLookupStamped : public FHashLookup
+	{
+	protected:
+		TStampedArray<uint64> Data;
+
+	public:
+		explicit FHashLookupStamped(const uint64 InitValue, const int32 Size)
+			: FHashLookup(InitValue, Size)
+		{
+			Data.Init(InitValue, Size);
+		}
+
+		FORCEINLINE virtual void Set(const int32 At, const uint64 Value) override { Data.Set(At, Value); }
+		FORCEINLINE virtual uint64 Get(const int32 At) override { return Data.Get(At); }
+		virtual void Reset() override { Data.Reset(); }
+	};
+
 	template <typename T>
 	static TSharedPtr<FHashLookup> NewHashLookup(const uint64 InitValue, const int32 Size)
 	{
@@ -0,0 +1,54 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGEx
+{
+	/**
+	 * Fixed-size array whose entries are only valid if written during the current generation.
+	 * Reset bumps the generation instead of touching every entry, so clearing is O(1) regardless of size.
+	 */
+	template <typename T>
+	class TStampedArray
+	{
+	protected:
+		TArray<T> Values;
+		TArray<uint32> Stamps;
+		uint32 Generation = 1;
+		T DefaultValue = T{};
+
+	public:
+		TStampedArray() = default;
+
+		void Init(const T& InDefaultValue, const int32 InNum)
+		{
+			DefaultValue = InDefaultValue;
+			Values.SetNumUninitialized(InNum);
+			Stamps.Init(0, InNum);
+			Generation = 1;
+		}
+
+		FORCEINLINE int32 Num() const { return Values.Num(); }
+
+		FORCEINLINE bool IsSet(const int32 Index) const { return Stamps[Index] == Generation; }
+		FORCEINLINE T Get(const int32 Index) const { return Stamps[Index] == Generation ? Values[Index] : DefaultValue; }
+
+		FORCEINLINE void Set(const int32 Index, const T& InValue)
+		{
+			Values[Index] = InValue;
+			Stamps[Index] = Generation;
+		}
+
+		FORCEINLINE void Reset()
+		{
+			if (++Generation != 0) { return; }
+
+			// Wrapped around, stale stamps could collide with the new generation
+			FMemory::Memzero(Stamps.GetData(), Stamps.Num() * sizeof(uint32));
+			Generation = 1;
+		}
+	};
+}
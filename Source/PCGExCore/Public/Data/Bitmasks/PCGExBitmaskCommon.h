@@ -75,6 +75,9 @@ namespace PCGExBitmask
 
 	PCGEXCORE_API bool Compare(const EPCGExBitflagComparison Method, const int64& Flags, const int64& Mask);
 
+	/** Batch version of Compare over contiguous flags & masks. OutResults entries are AND-ed with the comparison outcome. */
+	PCGEXCORE_API void CompareScope(const EPCGExBitflagComparison Method, TConstArrayView<int64> Flags, TConstArrayView<int64> Masks, TArrayView<int8> OutResults);
+
 	FORCEINLINE static void Mutate(const EPCGExBitOp Operation, int64& Flags, const int64 Mask)
 	{
 		switch (Operation)
@@ -167,6 +167,11 @@ namespace PCGExData
 		virtual void SetVoid(const int32 Index, const void* Value) const = 0;
 		virtual void GetCurrentVoid(const int32 Index, void* OutValue) const { GetVoid(Index, OutValue); }
 
+		// Contiguous range access - OutValues/Values are tightly packed working-type values (stride = working type size)
+		// Only valid for working types that don't need lifecycle management.
+		virtual void GetVoidRange(const int32 Start, const int32 Count, void* OutValues) const;
+		virtual void SetVoidRange(const int32 Start, const int32 Count, const void* Values) const;
+
 		// Hash computation
 		virtual PCGExValueHash ReadValueHash(const int32 Index) const = 0;
 
@@ -42,6 +42,9 @@ namespace PCGExData
 		virtual void GetVoid(const int32 Index, void* OutValue) const override;
 		virtual void SetVoid(const int32 Index, const void* Value) const override;
 
+		virtual void GetVoidRange(const int32 Start, const int32 Count, void* OutValues) const override;
+		virtual void SetVoidRange(const int32 Start, const int32 Count, const void* Values) const override;
+
 		virtual PCGExValueHash ReadValueHash(const int32 Index) const override;
 	};
 
@@ -69,6 +72,9 @@ namespace PCGExData
 		virtual void SetVoid(const int32 Index, const void* Value) const override;
 		virtual void GetCurrentVoid(const int32 Index, void* OutValue) const override;
 
+		virtual void GetVoidRange(const int32 Start, const int32 Count, void* OutValues) const override;
+		virtual void SetVoidRange(const int32 Start, const int32 Count, const void* Values) const override;
+
 		virtual TSharedPtr<IBuffer> GetBuffer() const override;
 		virtual bool EnsureReadable() const override;
 
@@ -53,6 +53,9 @@ namespace PCGExMath::Geo
 	public:
 		bool Process(const TArrayView<FVector>& Positions, const FPCGExGeo2DProjectionDetails& ProjectionDetails);
 
+		/** Only fills DelaunayEdges & DelaunayHull, without building sites or their adjacency. */
+		bool ProcessEdges(const TArrayView<FVector>& Positions, const FPCGExGeo2DProjectionDetails& ProjectionDetails);
+
 		void RemoveLongestEdges(const TArrayView<FVector>& Positions);
 		void RemoveLongestEdges(const TArrayView<FVector>& Positions, TSet<uint64>& LongestEdges);
 
@@ -91,6 +94,9 @@ namespace PCGExMath::Geo
 	protected:
 		void Clear();
 
+		/** Tetrahedralize positions, using the tiled parallel path when enabled and the input is large enough. */
+		bool Tetrahedralize(const TArrayView<FVector>& Positions, TArray<FIntVector4>& OutTetrahedra) const;
+
 	public:
 		template <bool bComputeAdjacency = false, bool bComputeHull = false>
 		bool Process(const TArrayView<FVector>& Positions)
@@ -98,9 +104,9 @@ namespace PCGExMath::Geo
 			Clear();
 			if (Positions.IsEmpty() || Positions.Num() <= 3) { return false; }
 
-			UE::Geometry::FDelaunay3 Tetrahedralization;
+			TArray<FIntVector4> Tetrahedra;
 
-			if (!Tetrahedralization.Triangulate(Positions))
+			if (!Tetrahedralize(Positions, Tetrahedra))
 			{
 				Clear();
 				return false;
@@ -108,8 +114,6 @@ namespace PCGExMath::Geo
 
 			IsValid = true;
 
-			TArray<FIntVector4> Tetrahedra = Tetrahedralization.GetTetrahedra();
-
 			const int32 NumSites = Tetrahedra.Num();
 			const int32 NumReserve = NumSites * 3;
 
@@ -193,6 +197,72 @@ namespace PCGExMath::Geo
 			return IsValid;
 		}
 
+		/** Only fills DelaunayEdges (& DelaunayHull), without building sites. */
+		template <bool bComputeHull = false>
+		bool ProcessEdges(const TArrayView<FVector>& Positions)
+		{
+			Clear();
+			if (Positions.IsEmpty() || Positions.Num() <= 3) { return false; }
+
+			TArray<FIntVector4> Tetrahedra;
+
+			if (!Tetrahedralize(Positions, Tetrahedra))
+			{
+				Clear();
+				return false;
+			}
+
+			IsValid = true;
+
+			const int32 NumTetrahedra = Tetrahedra.Num();
+			DelaunayEdges.Reserve(NumTetrahedra * 3);
+
+			TSet<uint32> FacesUsage;
+			if constexpr (bComputeHull) { FacesUsage.Reserve(NumTetrahedra); }
+
+			for (const FIntVector4& Tetrahedron : Tetrahedra)
+			{
+				for (int a = 0; a < 4; a++)
+				{
+					for (int b = a + 1; b < 4; b++)
+					{
+						DelaunayEdges.Add(PCGEx::H64U(Tetrahedron[a], Tetrahedron[b]));
+					}
+				}
+
+				if constexpr (bComputeHull)
+				{
+					FDelaunaySite3 Site(Tetrahedron);
+					Site.ComputeFaces();
+
+					for (int f = 0; f < 4; f++)
+					{
+						const uint32 FH = Site.Faces[f];
+						bool bAlreadySet = false;
+						FacesUsage.Add(FH, &bAlreadySet);
+						if (bAlreadySet) { FacesUsage.Remove(FH); }
+					}
+				}
+			}
+
+			if constexpr (bComputeHull)
+			{
+				for (const FIntVector4& Tetrahedron : Tetrahedra)
+				{
+					FDelaunaySite3 Site(Tetrahedron);
+					Site.ComputeFaces();
+
+					for (int f = 0; f < 4; f++)
+					{
+						if (!FacesUsage.Contains(Site.Faces[f])) { continue; }
+						for (int fi = 0; fi < 3; fi++) { DelaunayHull.Add(Site.Vtx[MTX[f][fi]]); }
+					}
+				}
+			}
+
+			return IsValid;
+		}
+
 		void RemoveLongestEdges(const TArrayView<FVector>& Positions);
 		void RemoveLongestEdges(const TArrayView<FVector>& Positions, TSet<uint64>& LongestEdges);
 	};
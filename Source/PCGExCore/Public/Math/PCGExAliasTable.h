@@ -0,0 +1,41 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExMath
+{
+	/**
+	 * Walker/Vose alias table over a set of weights.
+	 * Linear to build, constant time per weighted pick regardless of the number of weights.
+	 */
+	class PCGEXCORE_API FAliasTable
+	{
+	protected:
+		TArray<double> Probabilities;
+		TArray<int32> Aliases;
+
+	public:
+		FAliasTable() = default;
+		~FAliasTable() = default;
+
+		/** Negative weights are treated as zero; if all weights are zero, picks are uniform. */
+		void Build(const TConstArrayView<int32> InWeights);
+		void Reset();
+
+		FORCEINLINE int32 Num() const { return Probabilities.Num(); }
+		FORCEINLINE bool IsEmpty() const { return Probabilities.IsEmpty(); }
+
+		/** @return index of the picked weight, or -1 if the table is empty */
+		FORCEINLINE int32 Pick(const int32 Seed) const
+		{
+			if (Probabilities.IsEmpty()) { return -1; }
+
+			const FRandomStream Stream(Seed);
+			const int32 Column = Stream.RandRange(0, Probabilities.Num() - 1);
+			return Stream.GetFraction() < Probabilities[Column] ? Column : Aliases[Column];
+		}
+	};
+}
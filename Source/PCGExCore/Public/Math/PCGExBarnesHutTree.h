@@ -0,0 +1,101 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExMath
+{
+	/**
+	 * Flattened Barnes-Hut octree over a set of unit-mass positions.
+	 * Each node caches the center of mass of the positions it contains, so far-away groups can be approximated
+	 * as a single body during n-body style accumulations. Meant to be rebuilt whenever positions change.
+	 */
+	class PCGEXCORE_API FBarnesHutTree
+	{
+	public:
+		struct FNode
+		{
+			FVector Center = FVector::ZeroVector;
+			FVector CenterOfMass = FVector::ZeroVector;
+			double Size = 0; // Full edge length of the node cube
+			int32 Start = 0;
+			int32 Count = 0;
+			int32 FirstChild = -1; // Children are stored as 8 consecutive nodes
+
+			FNode() = default;
+
+			FORCEINLINE bool IsLeaf() const { return FirstChild == -1; }
+		};
+
+	protected:
+		TArray<FNode> Nodes;
+		TArray<FVector> Positions;
+		TArray<int32> Items;
+
+		void BuildNode(const int32 NodeIndex, const int32 Depth, TArray<int32>& Scratch);
+
+	public:
+		FBarnesHutTree() = default;
+		~FBarnesHutTree() = default;
+
+		void Build(const TConstArrayView<FVector> InPositions, const int32 InLeafSize = 4);
+		void Reset();
+
+		FORCEINLINE int32 Num() const { return Items.Num(); }
+		FORCEINLINE bool IsEmpty() const { return Items.IsEmpty(); }
+
+		/**
+		 * Invokes Func(const FVector& Location, double Mass) for every body or group of bodies acting on the given position.
+		 * Groups whose size to distance ratio is below Theta are reported once at their center of mass, with Mass being their item count;
+		 * others are opened. Item at IgnoreIndex (in original ordering) is skipped.
+		 * Theta of 0 degrades to an exact all-pairs evaluation.
+		 */
+		template <typename FuncType>
+		void ForEachBody(const FVector& Position, const double Theta, const int32 IgnoreIndex, FuncType&& Func) const
+		{
+			if (Nodes.IsEmpty()) { return; }
+
+			const double ThetaSquared = Theta * Theta;
+
+			TArray<int32, TInlineAllocator<64>> Stack;
+			Stack.Add(0);
+
+			while (!Stack.IsEmpty())
+			{
+				const FNode& Node = Nodes[Stack.Pop(EAllowShrinking::No)];
+
+				if (Node.IsLeaf())
+				{
+					const int32 End = Node.Start + Node.Count;
+					for (int32 i = Node.Start; i < End; i++)
+					{
+						if (Items[i] == IgnoreIndex) { continue; }
+						Func(Positions[i], 1.0);
+					}
+					continue;
+				}
+
+				// Never approximate a group the query lies in; its center of mass may be arbitrarily close
+				const FVector Local = (Position - Node.Center).GetAbs();
+				const double HalfSize = Node.Size * 0.5;
+				const bool bInside = Local.X <= HalfSize && Local.Y <= HalfSize && Local.Z <= HalfSize;
+
+				if (!bInside && FMath::Square(Node.Size) < ThetaSquared * FVector::DistSquared(Position, Node.CenterOfMass))
+				{
+					Func(Node.CenterOfMass, static_cast<double>(Node.Count));
+					continue;
+				}
+
+				for (int32 c = 0; c < 8; c++)
+				{
+					if (Nodes[Node.FirstChild + c].Count) { Stack.Add(Node.FirstChild + c); }
+				}
+			}
+		}
+
+	protected:
+		int32 LeafSize = 4;
+	};
+}
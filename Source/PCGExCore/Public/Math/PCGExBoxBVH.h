@@ -0,0 +1,81 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExMath
+{
+	/**
+	 * Flattened, static bounding volume hierarchy over a set of boxes.
+	 * Built once by median splits of box centers along the largest axis; leaves reference contiguous ranges of reordered boxes,
+	 * and queries report the original index of each box. Read-only once built, so it can be queried from any number of threads.
+	 */
+	class PCGEXCORE_API FBoxBVH
+	{
+	public:
+		struct FNode
+		{
+			FBox Bounds = FBox(ForceInit);
+			int32 Start = 0;
+			int32 End = 0;
+			int32 Left = -1;
+			int32 Right = -1;
+
+			FNode() = default;
+
+			FNode(const int32 InStart, const int32 InEnd)
+				: Start(InStart), End(InEnd)
+			{
+			}
+
+			FORCEINLINE bool IsLeaf() const { return Left == -1; }
+		};
+
+	protected:
+		TArray<FNode> Nodes;
+		TArray<FBox> Boxes;
+		TArray<int32> Items;
+
+	public:
+		FBoxBVH() = default;
+		~FBoxBVH() = default;
+
+		void Build(const TConstArrayView<FBox> InBoxes, const int32 InLeafSize = 4);
+		void Reset();
+
+		FORCEINLINE int32 Num() const { return Items.Num(); }
+		FORCEINLINE bool IsEmpty() const { return Items.IsEmpty(); }
+		FORCEINLINE const FBox& GetBounds() const { return Nodes[0].Bounds; }
+
+		/** Invokes Func(Item) for every box intersecting the query box. */
+		template <typename FuncType>
+		void ForEachOverlapping(const FBox& Query, FuncType&& Func) const
+		{
+			if (Nodes.IsEmpty()) { return; }
+
+			TArray<int32, TInlineAllocator<64>> Stack;
+			Stack.Add(0);
+
+			while (!Stack.IsEmpty())
+			{
+				const FNode& Node = Nodes[Stack.Pop(EAllowShrinking::No)];
+				if (!Node.Bounds.Intersect(Query)) { continue; }
+
+				if (Node.IsLeaf())
+				{
+					for (int32 i = Node.Start; i < Node.End; i++)
+					{
+						if (Boxes[i].Intersect(Query)) { Func(Items[i]); }
+					}
+
+					continue;
+				}
+
+				Stack.Add(Node.Right);
+				Stack.Add(Node.Left);
+			}
+		}
+	};
+}
@@ -0,0 +1,228 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExMath
+{
+	/**
+	 * Flattened, static kd-tree over a set of positions.
+	 * Nodes are stored in a single array, leaves reference contiguous ranges of reordered positions,
+	 * and queries report the original index of each position.
+	 * Exact distance ties are resolved towards the lowest original index, so results match a linear scan in index order.
+	 */
+	class PCGEXCORE_API FKDTree
+	{
+	public:
+		struct FNode
+		{
+			FBox Bounds = FBox(ForceInit);
+			int32 Start = 0;
+			int32 End = 0;
+			int32 Left = -1;
+			int32 Right = -1;
+
+			FNode() = default;
+
+			FNode(const int32 InStart, const int32 InEnd)
+				: Start(InStart), End(InEnd)
+			{
+			}
+
+			FORCEINLINE bool IsLeaf() const { return Left == -1; }
+		};
+
+		struct FNearest
+		{
+			int32 Item = -1;
+			double DistSquared = MAX_dbl;
+
+			FNearest() = default;
+
+			FNearest(const int32 InItem, const double InDistSquared)
+				: Item(InItem), DistSquared(InDistSquared)
+			{
+			}
+
+			FORCEINLINE bool operator<(const FNearest& Other) const { return DistSquared < Other.DistSquared || (DistSquared == Other.DistSquared && Item < Other.Item); }
+		};
+
+	protected:
+		TArray<FNode> Nodes;
+		TArray<FVector> Positions;
+		TArray<int32> Items;
+
+		struct FCandidate
+		{
+			double DistSquared = 0;
+			int32 Node = -1;
+
+			FCandidate() = default;
+
+			FCandidate(const double InDistSquared, const int32 InNode)
+				: DistSquared(InDistSquared), Node(InNode)
+			{
+			}
+
+			FORCEINLINE bool operator<(const FCandidate& Other) const { return DistSquared < Other.DistSquared; }
+		};
+
+		using FCandidateHeap = TArray<FCandidate, TInlineAllocator<64>>;
+
+	public:
+		FKDTree() = default;
+		~FKDTree() = default;
+
+		void Build(const TConstArrayView<FVector> InPositions, const int32 InLeafSize = 8);
+		void Reset();
+
+		FORCEINLINE int32 Num() const { return Items.Num(); }
+		FORCEINLINE bool IsEmpty() const { return Items.IsEmpty(); }
+		FORCEINLINE FBox GetBounds() const { return Nodes.IsEmpty() ? FBox(ForceInit) : Nodes[0].Bounds; }
+
+		/** Nodes in depth-first order, children always come after their parent. Node 0 is the root. */
+		FORCEINLINE const TArray<FNode>& GetNodes() const { return Nodes; }
+		/** Original index of each position, leaves reference [Start, End) ranges of this array. */
+		FORCEINLINE const TArray<int32>& GetItems() const { return Items; }
+
+		/**
+		 * Best-first nearest search.
+		 * Filter is only invoked on items that would improve the current best, return false to skip an item.
+		 * @return original index of the nearest accepted item, -1 if none.
+		 */
+		template <typename FilterFunc>
+		int32 FindNearest(const FVector& Query, double& OutDistSquared, FilterFunc&& Filter) const
+		{
+			OutDistSquared = MAX_dbl;
+			if (Nodes.IsEmpty()) { return -1; }
+
+			int32 Best = -1;
+
+			FCandidateHeap Heap;
+			Heap.HeapPush(FCandidate(0, 0));
+
+			FCandidate Candidate;
+			while (!Heap.IsEmpty())
+			{
+				Heap.HeapPop(Candidate, EAllowShrinking::No);
+				if (Candidate.DistSquared > OutDistSquared) { break; } // Nodes at the exact best distance may still hold a lower index
+
+				const FNode& Node = Nodes[Candidate.Node];
+				if (Node.IsLeaf())
+				{
+					for (int32 i = Node.Start; i < Node.End; i++)
+					{
+						const double DistSquared = FVector::DistSquared(Positions[i], Query);
+						if ((DistSquared < OutDistSquared || (DistSquared == OutDistSquared && Items[i] < Best)) && Filter(Items[i]))
+						{
+							OutDistSquared = DistSquared;
+							Best = Items[i];
+						}
+					}
+
+					continue;
+				}
+
+				PushChild(Heap, Node.Left, Query, OutDistSquared);
+				PushChild(Heap, Node.Right, Query, OutDistSquared);
+			}
+
+			return Best;
+		}
+
+		int32 FindNearest(const FVector& Query, double& OutDistSquared) const
+		{
+			return FindNearest(Query, OutDistSquared, [](const int32) { return true; });
+		}
+
+		/**
+		 * Best-first k-nearest search.
+		 * OutResults is sorted from closest to farthest and holds at most K entries.
+		 */
+		template <typename FilterFunc>
+		void FindKNearest(const FVector& Query, const int32 K, TArray<FNearest>& OutResults, FilterFunc&& Filter) const
+		{
+			OutResults.Reset();
+			if (Nodes.IsEmpty() || K <= 0) { return; }
+
+			// Max-heap so the current worst result sits on top
+			auto WorstFirst = [](const FNearest& A, const FNearest& B) { return B < A; };
+			auto GetBound = [&]() { return OutResults.Num() < K ? MAX_dbl : OutResults.HeapTop().DistSquared; };
+
+			OutResults.Reserve(K);
+
+			FCandidateHeap Heap;
+			Heap.HeapPush(FCandidate(0, 0));
+
+			FCandidate Candidate;
+			while (!Heap.IsEmpty())
+			{
+				Heap.HeapPop(Candidate, EAllowShrinking::No);
+				if (Candidate.DistSquared > GetBound()) { break; }
+
+				const FNode& Node = Nodes[Candidate.Node];
+				if (Node.IsLeaf())
+				{
+					for (int32 i = Node.Start; i < Node.End; i++)
+					{
+						const FNearest Nearest(Items[i], FVector::DistSquared(Positions[i], Query));
+						if ((OutResults.Num() == K && !(Nearest < OutResults.HeapTop())) || !Filter(Nearest.Item)) { continue; }
+
+						if (OutResults.Num() == K) { OutResults.HeapPopDiscard(WorstFirst, EAllowShrinking::No); }
+						OutResults.HeapPush(Nearest, WorstFirst);
+					}
+
+					continue;
+				}
+
+				const double Bound = GetBound();
+				PushChild(Heap, Node.Left, Query, Bound);
+				PushChild(Heap, Node.Right, Query, Bound);
+			}
+
+			OutResults.Sort();
+		}
+
+		void FindKNearest(const FVector& Query, const int32 K, TArray<FNearest>& OutResults) const
+		{
+			FindKNearest(Query, K, OutResults, [](const int32) { return true; });
+		}
+
+		/** Invokes Func(Item, DistSquared) for every item within the given radius. */
+		template <typename FuncType>
+		void ForEachInRadius(const FVector& Query, const double RadiusSquared, FuncType&& Func) const
+		{
+			if (Nodes.IsEmpty()) { return; }
+
+			TArray<int32, TInlineAllocator<64>> Stack;
+			Stack.Add(0);
+
+			while (!Stack.IsEmpty())
+			{
+				const FNode& Node = Nodes[Stack.Pop(EAllowShrinking::No)];
+				if (Node.Bounds.ComputeSquaredDistanceToPoint(Query) > RadiusSquared) { continue; }
+
+				if (Node.IsLeaf())
+				{
+					for (int32 i = Node.Start; i < Node.End; i++)
+					{
+						if (const double DistSquared = FVector::DistSquared(Positions[i], Query); DistSquared <= RadiusSquared) { Func(Items[i], DistSquared); }
+					}
+
+					continue;
+				}
+
+				Stack.Add(Node.Right);
+				Stack.Add(Node.Left);
+			}
+		}
+
+	protected:
+		FORCEINLINE void PushChild(FCandidateHeap& Heap, const int32 Child, const FVector& Query, const double Bound) const
+		{
+			if (const double DistSquared = Nodes[Child].Bounds.ComputeSquaredDistanceToPoint(Query); DistSquared <= Bound) { Heap.HeapPush(FCandidate(DistSquared, Child)); }
+		}
+	};
+}
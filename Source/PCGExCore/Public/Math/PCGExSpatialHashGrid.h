@@ -0,0 +1,70 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExMath
+{
+	/**
+	 * Uniform grid over a set of positions, stored as sorted runs of item indices per cell.
+	 * Meant to be rebuilt whenever positions change; neighborhood queries visit the 3x3x3 cells around a location,
+	 * so any item closer than the cell size along every axis is guaranteed to be visited.
+	 */
+	class PCGEXCORE_API FSpatialHashGrid
+	{
+	protected:
+		double CellSize = 1;
+		double InvCellSize = 1;
+
+		TMap<uint64, FIntPoint> Cells; // Start & Count within Items
+		TArray<int32> Items;
+
+	public:
+		FSpatialHashGrid() = default;
+		~FSpatialHashGrid() = default;
+
+		void Build(const TConstArrayView<FVector> InPositions, const double InCellSize);
+		void Reset();
+
+		FORCEINLINE double GetCellSize() const { return CellSize; }
+		FORCEINLINE bool IsEmpty() const { return Items.IsEmpty(); }
+
+		FORCEINLINE FIntVector GetCell(const FVector& Position) const
+		{
+			return FIntVector(
+				FMath::FloorToInt32(Position.X * InvCellSize),
+				FMath::FloorToInt32(Position.Y * InvCellSize),
+				FMath::FloorToInt32(Position.Z * InvCellSize));
+		}
+
+		// 21 bits per axis; wrapped cells only ever add candidates, never drop them
+		static FORCEINLINE uint64 GetCellKey(const int32 X, const int32 Y, const int32 Z)
+		{
+			return (static_cast<uint64>(X & 0x1FFFFF) << 42) | (static_cast<uint64>(Y & 0x1FFFFF) << 21) | static_cast<uint64>(Z & 0x1FFFFF);
+		}
+
+		/** Invokes Func(ItemIndex) for every item in the cells surrounding the given position. */
+		template <typename FuncType>
+		void ForEachInNeighborhood(const FVector& Position, FuncType&& Func) const
+		{
+			const FIntVector Cell = GetCell(Position);
+
+			for (int32 X = Cell.X - 1; X <= Cell.X + 1; X++)
+			{
+				for (int32 Y = Cell.Y - 1; Y <= Cell.Y + 1; Y++)
+				{
+					for (int32 Z = Cell.Z - 1; Z <= Cell.Z + 1; Z++)
+					{
+						const FIntPoint* Range = Cells.Find(GetCellKey(X, Y, Z));
+						if (!Range) { continue; }
+
+						const int32 End = Range->X + Range->Y;
+						for (int32 i = Range->X; i < End; i++) { Func(Items[i]); }
+					}
+				}
+			}
+		}
+	};
+}
@@ -31,6 +31,8 @@ struct PCGEXCORE_API FPCGExCoreSettingsCache
 	bool bDefaultScopedAttributeGet = true;
 	bool bBulkInitData = false;
 	bool bUseDelaunator = true;
+	bool bParallelDelaunay = false;
+	int32 ParallelDelaunayMinPoints = 200000;
 	bool bAssertOnEmptyThread = true;
 
 	bool bUseNativeColorsIfPossible = true;
@@ -41,6 +43,14 @@ struct PCGEXCORE_API FPCGExCoreSettingsCache
 	bool bDefaultBuildAndCacheClusters = true;
 	EPCGExExecutionPolicy ExecutionPolicy = EPCGExExecutionPolicy::Default;
 
+	bool bPersistentClusterCache = false;
+	int32 PersistentClusterCacheMinNodes = 4096;
+	FString PersistentClusterCacheDirectory;
+	int32 PersistentClusterCacheMaxSizeMB = 2048;
+
+	bool bAdaptiveFilterOrdering = false;
+	bool bLogAdaptiveFilterOrdering = false;
+
 	int32 SmallPointsSize = 1024;
 	bool IsSmallPointSize(const int32 InNum) const { return InNum <= SmallPointsSize; }
 
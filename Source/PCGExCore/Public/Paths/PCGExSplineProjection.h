@@ -0,0 +1,65 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FPCGSplineStruct;
+
+namespace PCGExPaths
+{
+	/**
+	 * Precomputed closest-point acceleration for a single spline.
+	 * The spline is sampled into a dense polyline whose segments are stored in a flat BVH, along with their input key range.
+	 * Projection is a bounded best-first search for the closest polyline segment, followed by a single refinement step on the curve.
+	 * Works in spline local space, like FindInputKeyClosestToWorldLocation.
+	 */
+	class PCGEXCORE_API FSplineProjection : public TSharedFromThis<FSplineProjection>
+	{
+	protected:
+		struct FNode
+		{
+			FBox Bounds = FBox(ForceInit);
+			int32 Start = 0;
+			int32 End = 0;
+			int32 Left = -1;
+			int32 Right = -1;
+
+			FNode() = default;
+
+			FNode(const int32 InStart, const int32 InEnd)
+				: Start(InStart), End(InEnd)
+			{
+			}
+
+			FORCEINLINE bool IsLeaf() const { return Left == -1; }
+		};
+
+		const FInterpCurveVector* Positions = nullptr;
+		FTransform Transform = FTransform::Identity;
+
+		TArray<FNode> Nodes;
+		TArray<int32> Segments;
+		TArray<FVector> Points;
+		TArray<double> Keys;
+
+		double MaxKey = 0;
+
+	public:
+		/**
+		 * @param InSpline spline to project onto. Must outlive this object.
+		 * @param InSamplesPerSegment dense polyline resolution, per spline segment.
+		 */
+		explicit FSplineProjection(const FPCGSplineStruct& InSpline, const int32 InSamplesPerSegment = 16);
+
+		bool IsValid() const { return !Nodes.IsEmpty(); }
+
+		/** Drop-in replacement for FPCGSplineStruct::FindInputKeyClosestToWorldLocation */
+		double FindInputKeyClosestToWorldLocation(const FVector& WorldLocation) const;
+
+	protected:
+		double FindInputKeyClosestToLocalLocation(const FVector& LocalLocation) const;
+		double ProjectOnSegment(const int32 Segment, const FVector& LocalLocation, double& OutDistSquared) const;
+	};
+}
@@ -75,7 +75,7 @@ namespace PCGExSorting
 	 *  
 	 * Usage:
 	 *   auto Cache = Sorter->BuildCache(NumPoints);
-	 *   Order.Sort([&](int32 A, int32 B) { return Cache->Compare(A, B); });
+	 *   Cache->Sort(Order);
 	 */
 	class PCGEXCORE_API FSortCache
 	{
@@ -104,6 +104,15 @@ namespace PCGExSorting
 		/** Get number of rules */
 		FORCEINLINE int32 NumRules() const { return Rules.Num(); }
 
+		/**
+		 * Sort indices using cached values.
+		 * Large inputs are encoded into order-preserving fixed-width keys (tolerant rules quantized into tolerance-wide buckets,
+		 * direction folded in), packed into as few composite keys as possible and sorted with a parallel LSD radix sort.
+		 * Neighboring buckets whose values come within tolerance are then re-sorted with Compare, so the result orders the same
+		 * as Compare regardless of input size. Small inputs use Compare.
+		 */
+		void Sort(TArray<int32>& InOutOrder) const;
+
 		/** Fast comparison using cached values. No virtual calls. */
 		FORCEINLINE bool Compare(const int32 A, const int32 B) const
 		{
@@ -5,6 +5,7 @@
 
 #include "PCGExH.h"
 #include "CoreMinimal.h"
+#include "Async/ParallelFor.h"
 
 namespace PCGExSortingHelpers
 {
@@ -73,4 +74,73 @@ namespace PCGExSortingHelpers
 			Swap(Curr, Out);
 		}
 	}
+
+	/**
+	 * Stable LSD radix sort by Key, parallelized over chunks.
+	 * Only the lowest NumBits of the keys are considered, and passes where every key shares the same digit are skipped.
+	 */
+	static void ParallelRadixSort(TArray<FIndexKey>& Keys, const int32 NumBits = 64)
+	{
+		const int32 N = Keys.Num();
+		if (N <= 1 || NumBits <= 0) { return; }
+
+		constexpr int32 NUM_BUCKETS = 256;
+		const int32 NumPasses = FMath::Min((NumBits + 7) / 8, static_cast<int32>(sizeof(uint64)));
+		const int32 NumChunks = FMath::Clamp(N / 65536, 1, 64);
+		const int32 ChunkSize = FMath::DivideAndRoundUp(N, NumChunks);
+
+		TArray<FIndexKey> Temp;
+		Temp.SetNumUninitialized(N);
+
+		FIndexKey* Curr = Keys.GetData();
+		FIndexKey* Out = Temp.GetData();
+
+		TArray<int32> Counts;
+		Counts.SetNumUninitialized(NumChunks * NUM_BUCKETS);
+
+		for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+		{
+			const int32 Shift = Pass * 8;
+
+			ParallelFor(NumChunks, [&](const int32 Chunk)
+			{
+				int32* Count = Counts.GetData() + Chunk * NUM_BUCKETS;
+				FMemory::Memzero(Count, sizeof(int32) * NUM_BUCKETS);
+
+				const int32 End = FMath::Min(N, (Chunk + 1) * ChunkSize);
+				for (int32 i = Chunk * ChunkSize; i < End; ++i) { Count[(Curr[i].Key >> Shift) & 0xFF]++; }
+			}, NumChunks == 1);
+
+			// Exclusive prefix sum, digit-major then chunk, to keep the sort stable
+			bool bSkipPass = false;
+			int32 Sum = 0;
+			for (int32 Digit = 0; Digit < NUM_BUCKETS && !bSkipPass; ++Digit)
+			{
+				const int32 DigitStart = Sum;
+				for (int32 Chunk = 0; Chunk < NumChunks; ++Chunk)
+				{
+					int32& Count = Counts[Chunk * NUM_BUCKETS + Digit];
+					const int32 Num = Count;
+					Count = Sum;
+					Sum += Num;
+				}
+
+				bSkipPass = Sum - DigitStart == N;
+			}
+
+			if (bSkipPass) { continue; }
+
+			ParallelFor(NumChunks, [&](const int32 Chunk)
+			{
+				int32* Offsets = Counts.GetData() + Chunk * NUM_BUCKETS;
+
+				const int32 End = FMath::Min(N, (Chunk + 1) * ChunkSize);
+				for (int32 i = Chunk * ChunkSize; i < End; ++i) { Out[Offsets[(Curr[i].Key >> Shift) & 0xFF]++] = Curr[i]; }
+			}, NumChunks == 1);
+
+			Swap(Curr, Out);
+		}
+
+		if (Curr != Keys.GetData()) { FMemory::Memcpy(Keys.GetData(), Curr, sizeof(FIndexKey) * N); }
+	}
 }
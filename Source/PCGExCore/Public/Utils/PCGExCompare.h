@@ -332,6 +332,14 @@ namespace PCGExCompare
 		}
 	}
 
+	/**
+	 * Batch version of Compare over contiguous values.
+	 * Each OutResults entry is AND-ed with the outcome of A[i] <Method> B[i]; the method switch is hoisted out of the loop
+	 * so the inner loops are branch-free and auto-vectorize.
+	 */
+	PCGEXCORE_API
+	void CompareScope(const EPCGExComparison Method, TConstArrayView<double> A, TConstArrayView<double> B, TArrayView<int8> OutResults, const double Tolerance = DBL_COMPARE_TOLERANCE);
+
 	PCGEXCORE_API
 	bool Compare(const EPCGExComparison Method, const TSharedPtr<PCGExData::IDataValue>& A, const double B, const double Tolerance = DBL_COMPARE_TOLERANCE);
 
@@ -498,6 +506,9 @@ struct PCGEXCORE_API FPCGExDotComparisonDetails
 	bool Test(const double A, const double B) const;
 	bool Test(const double A, const int32 Index) const;
 
+	/** Batch test of contiguous dot values starting at point index Start. OutResults entries are AND-ed with the test outcome. */
+	void TestScope(const int32 Start, TConstArrayView<double> Dots, TArrayView<int8> OutResults) const;
+
 	void RegisterBuffersDependencies(FPCGExContext* InContext, PCGExData::FFacadePreloader& FacadePreloader) const;
 	void RegisterConsumableAttributesWithData(FPCGExContext* InContext, const UPCGData* InData) const;
 	bool GetOnlyUseDataDomain() const;
@@ -0,0 +1,115 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/PCGExStampedArray.h"
+
+namespace PCGEx
+{
+	/**
+	 * Monotone radix heap, an alternative to FScoredQueue with the same Enqueue/Dequeue contract.
+	 * Meant for searches where dequeued scores never decrease (non-negative edge scores, consistent heuristics) :
+	 * entries are bucketed by the highest bit that differs from the last dequeued key, so there is no sift,
+	 * and decrease-key is lazy -- outdated entries are skipped when dequeued.
+	 * Scores lower than the last dequeued one are clamped to it; the queue stays valid but ordering is no longer exact.
+	 */
+	class FRadixQueue
+	{
+	protected:
+		struct FEntry
+		{
+			uint64 Key;
+			double Score;
+			int32 Index;
+		};
+
+		static constexpr int32 NumBuckets = 65;
+
+		TArray<FEntry> Buckets[NumBuckets];
+		uint64 LastKey = 0;
+		int32 Size = 0; // Includes outdated entries
+
+		// Order-preserving mapping of a double onto an unsigned integer
+		static FORCEINLINE uint64 ToKey(const double InScore)
+		{
+			uint64 Bits;
+			FMemory::Memcpy(&Bits, &InScore, sizeof(uint64));
+			return (Bits & 0x8000000000000000ULL) ? ~Bits : Bits | 0x8000000000000000ULL;
+		}
+
+		FORCEINLINE int32 GetBucket(const uint64 Key) const
+		{
+			return Key == LastKey ? 0 : 64 - static_cast<int32>(FMath::CountLeadingZeros64(Key ^ LastKey));
+		}
+
+		void Redistribute()
+		{
+			int32 B = 1;
+			while (Buckets[B].IsEmpty()) { B++; }
+
+			TArray<FEntry>& Source = Buckets[B];
+
+			uint64 MinKey = MAX_uint64;
+			for (const FEntry& Entry : Source) { MinKey = FMath::Min(MinKey, Entry.Key); }
+			LastKey = MinKey;
+
+			// Every entry lands in a strictly lower bucket
+			for (const FEntry& Entry : Source) { Buckets[GetBucket(Entry.Key)].Add(Entry); }
+			Source.Reset();
+		}
+
+	public:
+		TStampedArray<double> Scores; // Best registered score, MAX_dbl if untouched since last reset
+
+		explicit FRadixQueue(const int32 InSize)
+		{
+			Scores.Init(MAX_dbl, InSize);
+		}
+
+		FORCEINLINE bool IsEmpty() const { return Size == 0; }
+		FORCEINLINE double GetScore(const int32 Index) const { return Scores.Get(Index); }
+
+		bool Enqueue(const int32 Index, const double InScore)
+		{
+			if (Scores.Get(Index) <= InScore) { return false; }
+
+			Scores.Set(Index, InScore);
+
+			const uint64 Key = FMath::Max(ToKey(InScore), LastKey);
+			Buckets[GetBucket(Key)].Add(FEntry{Key, InScore, Index});
+			Size++;
+
+			return true;
+		}
+
+		bool Dequeue(int32& OutItem, double& OutScore)
+		{
+			while (Size > 0)
+			{
+				if (Buckets[0].IsEmpty()) { Redistribute(); }
+
+				const FEntry Entry = Buckets[0].Pop(EAllowShrinking::No);
+				Size--;
+
+				// Superseded by a better score enqueued later
+				if (Entry.Score != Scores.Get(Entry.Index)) { continue; }
+
+				OutItem = Entry.Index;
+				OutScore = Entry.Score;
+				return true;
+			}
+
+			return false;
+		}
+
+		void Reset()
+		{
+			for (TArray<FEntry>& Bucket : Buckets) { Bucket.Reset(); }
+			LastKey = 0;
+			Size = 0;
+			Scores.Reset();
+		}
+	};
+}
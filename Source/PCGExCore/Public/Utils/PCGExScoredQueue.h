@@ -13,6 +13,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/PCGExStampedArray.h"
 
 namespace PCGEx
 {
@@ -67,7 +68,7 @@ namespace PCGEx
 		}
 
 	public:
-		TArray<double> Scores; // Public for compatibility with existing code
+		TStampedArray<double> Scores; // Best registered score, MAX_dbl if untouched since last reset
 
 		explicit FScoredQueue(const int32 InSize)
 		{
@@ -76,15 +77,16 @@ namespace PCGEx
 			Scores.Init(MAX_dbl, InSize);
 		}
 
+		FORCEINLINE double GetScore(const int32 Index) const { return Scores.Get(Index); }
+
 		FORCEINLINE bool IsEmpty() const { return Size == 0; }
 		FORCEINLINE int32 Num() const { return Size; }
 
 		bool Enqueue(const int32 Index, const double InScore)
 		{
-			double& RegisteredScore = Scores[Index];
-			if (RegisteredScore <= InScore) { return false; }
+			if (Scores.Get(Index) <= InScore) { return false; }
 
-			RegisteredScore = InScore;
+			Scores.Set(Index, InScore);
 
 			const int32 ExistingPos = HeapIndex[Index];
 			if (ExistingPos != -1)
@@ -129,7 +131,7 @@ namespace PCGEx
 		{
 			for (int32 i = 0; i < Size; i++) { HeapIndex[Heap[i].Value] = -1; }
 			Size = 0;
-			for (double& Score : Scores) { Score = MAX_dbl; }
+			Scores.Reset();
 		}
 	};
 }
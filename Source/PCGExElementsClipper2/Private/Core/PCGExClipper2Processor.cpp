@@ -18,6 +18,7 @@
 #include "Clipper2Lib/clipper.h"
 #include "Core/PCGExUnionData.h"
 #include "Math/PCGExMathDistances.h"
+#include "Sorting/PCGExSortingHelpers.h"
 #include "Async/ParallelFor.h"
 
 #define LOCTEXT_NAMESPACE "PCGExClipper2ProcessorElement"
@@ -43,6 +44,146 @@ namespace PCGExClipper2
 
 #pragma endregion
 
+#pragma region Union
+
+	namespace Union
+	{
+		// Below this many paths, a single union pass beats splitting the work
+		constexpr int32 MinParallelPaths = 64;
+		constexpr int32 TileSize = 32;
+
+		static uint64 SpreadBits(uint64 V)
+		{
+			V &= 0xFFFFFFFF;
+			V = (V | (V << 16)) & 0x0000FFFF0000FFFF;
+			V = (V | (V << 8)) & 0x00FF00FF00FF00FF;
+			V = (V | (V << 4)) & 0x0F0F0F0F0F0F0F0F;
+			V = (V | (V << 2)) & 0x3333333333333333;
+			V = (V | (V << 1)) & 0x5555555555555555;
+			return V;
+		}
+
+		static void Execute(
+			const PCGExClipper2Lib::Paths64& InPaths,
+			const PCGExClipper2Lib::Paths64* InOpenPaths,
+			const PCGExClipper2Lib::ZCallback64& InZCallback,
+			PCGExClipper2Lib::Paths64& OutUnion)
+		{
+			PCGExClipper2Lib::Clipper64 Clipper;
+			Clipper.SetZCallback(InZCallback);
+			Clipper.AddSubject(InPaths);
+			if (InOpenPaths && !InOpenPaths->empty()) { Clipper.AddOpenSubject(*InOpenPaths); }
+			Clipper.Execute(PCGExClipper2Lib::ClipType::Union, PCGExClipper2Lib::FillRule::NonZero, OutUnion);
+		}
+	}
+
+	void UnionPaths(
+		const PCGExClipper2Lib::Paths64& InPaths,
+		const PCGExClipper2Lib::Paths64& InOpenPaths,
+		const PCGExClipper2Lib::ZCallback64& InZCallback,
+		PCGExClipper2Lib::Paths64& OutUnion,
+		const bool bParallel)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExClipper2::UnionPaths);
+
+		const int32 NumPaths = static_cast<int32>(InPaths.size());
+
+		bool bCanSplit = bParallel && NumPaths >= Union::MinParallelPaths;
+
+		if (bCanSplit)
+		{
+			// Merging tile results is an OR of their regions, which only matches NonZero when windings can't cancel out
+			const bool bPositive = PCGExClipper2Lib::IsPositive(InPaths[0]);
+			for (int32 i = 1; i < NumPaths; i++)
+			{
+				if (PCGExClipper2Lib::IsPositive(InPaths[i]) != bPositive)
+				{
+					bCanSplit = false;
+					break;
+				}
+			}
+		}
+
+		if (!bCanSplit)
+		{
+			Union::Execute(InPaths, &InOpenPaths, InZCallback, OutUnion);
+			return;
+		}
+
+		// Order paths along a Morton curve so that consecutive paths are spatial neighbors
+		const PCGExClipper2Lib::Rect64 Bounds = PCGExClipper2Lib::GetBounds(InPaths);
+		const double MinX = static_cast<double>(Bounds.left);
+		const double MinY = static_cast<double>(Bounds.top);
+		const double InvWidth = 1.0 / FMath::Max(1.0, static_cast<double>(Bounds.right) - MinX);
+		const double InvHeight = 1.0 / FMath::Max(1.0, static_cast<double>(Bounds.bottom) - MinY);
+
+		TArray<PCGEx::FIndexKey> Keys;
+		Keys.SetNumUninitialized(NumPaths);
+
+		for (int32 i = 0; i < NumPaths; i++)
+		{
+			const PCGExClipper2Lib::Rect64 PathBounds = PCGExClipper2Lib::GetBounds(InPaths[i]);
+			const double CX = ((static_cast<double>(PathBounds.left) + static_cast<double>(PathBounds.right)) * 0.5 - MinX) * InvWidth;
+			const double CY = ((static_cast<double>(PathBounds.top) + static_cast<double>(PathBounds.bottom)) * 0.5 - MinY) * InvHeight;
+
+			const uint64 QX = static_cast<uint64>(FMath::Clamp(CX, 0.0, 1.0) * static_cast<double>(MAX_uint32));
+			const uint64 QY = static_cast<uint64>(FMath::Clamp(CY, 0.0, 1.0) * static_cast<double>(MAX_uint32));
+
+			Keys[i] = PCGEx::FIndexKey{i, Union::SpreadBits(QX) | (Union::SpreadBits(QY) << 1)};
+		}
+
+		PCGExSortingHelpers::RadixSort(Keys);
+
+		// Union spatially coherent tiles concurrently
+		const int32 NumTiles = FMath::DivideAndRoundUp(NumPaths, Union::TileSize);
+
+		TArray<PCGExClipper2Lib::Paths64> Level;
+		Level.SetNum(NumTiles);
+
+		ParallelFor(
+			NumTiles, [&](const int32 TileIndex)
+			{
+				const int32 Start = TileIndex * Union::TileSize;
+				const int32 End = FMath::Min(Start + Union::TileSize, NumPaths);
+
+				PCGExClipper2Lib::Paths64 Tile;
+				Tile.reserve(End - Start);
+				for (int32 i = Start; i < End; i++) { Tile.push_back(InPaths[Keys[i].Index]); }
+
+				Union::Execute(Tile, nullptr, InZCallback, Level[TileIndex]);
+			});
+
+		// Merge neighboring results pairwise, concurrently, until the last two
+		while (Level.Num() > 2)
+		{
+			const int32 NumPairs = Level.Num() / 2;
+
+			TArray<PCGExClipper2Lib::Paths64> NextLevel;
+			NextLevel.SetNum(FMath::DivideAndRoundUp(Level.Num(), 2));
+
+			ParallelFor(
+				NumPairs, [&](const int32 PairIndex)
+				{
+					PCGExClipper2Lib::Paths64 Pair = MoveTemp(Level[PairIndex * 2]);
+					const PCGExClipper2Lib::Paths64& Other = Level[PairIndex * 2 + 1];
+					Pair.insert(Pair.end(), Other.begin(), Other.end());
+
+					Union::Execute(Pair, nullptr, InZCallback, NextLevel[PairIndex]);
+				});
+
+			if (Level.Num() % 2) { NextLevel.Last() = MoveTemp(Level.Last()); }
+			Level = MoveTemp(NextLevel);
+		}
+
+		// Final merge, along with open paths
+		PCGExClipper2Lib::Paths64 Remainder;
+		for (PCGExClipper2Lib::Paths64& Paths : Level) { Remainder.insert(Remainder.end(), Paths.begin(), Paths.end()); }
+
+		Union::Execute(Remainder, &InOpenPaths, InZCallback, OutUnion);
+	}
+
+#pragma endregion
+
 #pragma region FProcessingGroup
 
 	void FProcessingGroup::Prepare(const TSharedPtr<FOpData>& AllOpData)
@@ -85,23 +226,35 @@ namespace PCGExClipper2
 		if (InSettings->bUnionGroupBeforeOperation && SubjectPaths.size() > 1)
 		{
 			PCGExClipper2Lib::Paths64 Union;
-			PCGExClipper2Lib::Clipper64 Clipper;
-			Clipper.SetZCallback(CreateZCallback());
-			Clipper.AddSubject(SubjectPaths);
-			Clipper.AddOpenSubject(OpenSubjectPaths);
-			Clipper.Execute(PCGExClipper2Lib::ClipType::Union, PCGExClipper2Lib::FillRule::NonZero, Union);
-			SubjectPaths = Union;
+			UnionPaths(SubjectPaths, OpenSubjectPaths, CreateZCallback(), Union, InSettings->bParallelUnion);
+			SubjectPaths = MoveTemp(Union);
 		}
 
 		if (InSettings->bUnionOperandsBeforeOperation && OperandPaths.size() > 1)
 		{
-			PCGExClipper2Lib::Paths64 Union;
-			PCGExClipper2Lib::Clipper64 Clipper;
-			Clipper.SetZCallback(CreateZCallback());
-			Clipper.AddSubject(OperandPaths);
-			Clipper.AddOpenSubject(OpenOperandPaths);
-			Clipper.Execute(PCGExClipper2Lib::ClipType::Union, PCGExClipper2Lib::FillRule::NonZero, Union);
-			OperandPaths = Union;
+			if (!SharedOperandUnion)
+			{
+				PCGExClipper2Lib::Paths64 Union;
+				UnionPaths(OperandPaths, OpenOperandPaths, CreateZCallback(), Union, InSettings->bParallelUnion);
+				OperandPaths = MoveTemp(Union);
+				return;
+			}
+
+			{
+				// First group to get there computes the union for everyone
+				FScopeLock Lock(&SharedOperandUnion->Lock);
+				if (!SharedOperandUnion->bDone)
+				{
+					SharedOperandUnion->IntersectionsOwner = MakeShared<FProcessingGroup>();
+					UnionPaths(OperandPaths, OpenOperandPaths, SharedOperandUnion->IntersectionsOwner->CreateZCallback(), SharedOperandUnion->Paths, InSettings->bParallelUnion);
+					SharedOperandUnion->bDone = true;
+				}
+			}
+
+			OperandPaths = SharedOperandUnion->Paths;
+
+			FScopeLock Lock(&IntersectionLock);
+			IntersectionBlendInfos.Append(SharedOperandUnion->IntersectionsOwner->IntersectionBlendInfos);
 		}
 	}
 
@@ -130,16 +283,84 @@ namespace PCGExClipper2
 			TSharedPtr<FProcessingGroup> Group = WeakSelf.Pin();
 			if (!Group) { return; }
 
-			// Decode the source info from each vertex
-			uint32 E1BotPtIdx, E1BotSrcIdx;
-			uint32 E1TopPtIdx, E1TopSrcIdx;
-			uint32 E2BotPtIdx, E2BotSrcIdx;
-			uint32 E2TopPtIdx, E2TopSrcIdx;
+			struct FSourceEdge
+			{
+				uint32 BotPtIdx = 0;
+				uint32 BotSrcIdx = 0;
+				uint32 TopPtIdx = 0;
+				uint32 TopSrcIdx = 0;
+				PCGExClipper2Lib::Point64 Bot;
+				PCGExClipper2Lib::Point64 Top;
+			};
+
+			auto IsIntersection = [](const PCGExClipper2Lib::Point64& P)
+			{
+				return PCGEx::H64A(static_cast<uint64>(P.z)) == INTERSECTION_MARKER;
+			};
 
-			PCGEx::H64(static_cast<uint64>(e1bot.z), E1BotPtIdx, E1BotSrcIdx);
-			PCGEx::H64(static_cast<uint64>(e1top.z), E1TopPtIdx, E1TopSrcIdx);
-			PCGEx::H64(static_cast<uint64>(e2bot.z), E2BotPtIdx, E2BotSrcIdx);
-			PCGEx::H64(static_cast<uint64>(e2top.z), E2TopPtIdx, E2TopSrcIdx);
+			// Squared distance from P to the infinite line through A & B
+			auto LineDistSquared = [](const PCGExClipper2Lib::Point64& A, const PCGExClipper2Lib::Point64& B, const PCGExClipper2Lib::Point64& P)
+			{
+				const double DX = static_cast<double>(B.x - A.x);
+				const double DY = static_cast<double>(B.y - A.y);
+				const double LenSq = DX * DX + DY * DY;
+				const double PX = static_cast<double>(P.x - A.x);
+				const double PY = static_cast<double>(P.y - A.y);
+				if (LenSq < SMALL_NUMBER) { return PX * PX + PY * PY; }
+				const double Cross = DX * PY - DY * PX;
+				return (Cross * Cross) / LenSq;
+			};
+
+			// Edges created by a previous union (pre-processing, tiles & merges) may start or end on an intersection.
+			// Such an edge is a sub-segment of one of the two original edges that intersection lies on; keep the one it runs along.
+			auto ResolveEdge = [&](const PCGExClipper2Lib::Point64& Bot, const PCGExClipper2Lib::Point64& Top)
+			{
+				FSourceEdge Edge;
+				Edge.Bot = Bot;
+				Edge.Top = Top;
+				PCGEx::H64(static_cast<uint64>(Bot.z), Edge.BotPtIdx, Edge.BotSrcIdx);
+				PCGEx::H64(static_cast<uint64>(Top.z), Edge.TopPtIdx, Edge.TopSrcIdx);
+
+				const bool bBotIsIntersection = IsIntersection(Bot);
+				if (!bBotIsIntersection && !IsIntersection(Top)) { return Edge; }
+
+				const PCGExClipper2Lib::Point64& Pivot = bBotIsIntersection ? Bot : Top;
+				const PCGExClipper2Lib::Point64& Other = bBotIsIntersection ? Top : Bot;
+
+				FIntersectionBlendInfo PivotInfo;
+				{
+					FScopeLock Lock(&Group->IntersectionLock);
+					const FIntersectionBlendInfo* Found = Group->GetIntersectionBlendInfo(Pivot.x, Pivot.y);
+					if (!Found) { return Edge; }
+					PivotInfo = *Found;
+				}
+
+				const bool bUseE1 = LineDistSquared(PivotInfo.E1Bot, PivotInfo.E1Top, Other) <= LineDistSquared(PivotInfo.E2Bot, PivotInfo.E2Top, Other);
+
+				if (bUseE1)
+				{
+					Edge.BotPtIdx = PivotInfo.E1BotPointIdx;
+					Edge.BotSrcIdx = PivotInfo.E1BotSourceIdx;
+					Edge.TopPtIdx = PivotInfo.E1TopPointIdx;
+					Edge.TopSrcIdx = PivotInfo.E1TopSourceIdx;
+					Edge.Bot = PivotInfo.E1Bot;
+					Edge.Top = PivotInfo.E1Top;
+				}
+				else
+				{
+					Edge.BotPtIdx = PivotInfo.E2BotPointIdx;
+					Edge.BotSrcIdx = PivotInfo.E2BotSourceIdx;
+					Edge.TopPtIdx = PivotInfo.E2TopPointIdx;
+					Edge.TopSrcIdx = PivotInfo.E2TopSourceIdx;
+					Edge.Bot = PivotInfo.E2Bot;
+					Edge.Top = PivotInfo.E2Top;
+				}
+
+				return Edge;
+			};
+
+			const FSourceEdge E1 = ResolveEdge(e1bot, e1top);
+			const FSourceEdge E2 = ResolveEdge(e2bot, e2top);
 
 			// Calculate alpha along each edge
 			auto CalcAlpha = [](const PCGExClipper2Lib::Point64& Bot, const PCGExClipper2Lib::Point64& Top, const PCGExClipper2Lib::Point64& Pt) -> double
@@ -155,16 +376,20 @@ namespace PCGExClipper2
 			};
 
 			FIntersectionBlendInfo Info;
-			Info.E1BotPointIdx = E1BotPtIdx;
-			Info.E1BotSourceIdx = E1BotSrcIdx;
-			Info.E1TopPointIdx = E1TopPtIdx;
-			Info.E1TopSourceIdx = E1TopSrcIdx;
-			Info.E2BotPointIdx = E2BotPtIdx;
-			Info.E2BotSourceIdx = E2BotSrcIdx;
-			Info.E2TopPointIdx = E2TopPtIdx;
-			Info.E2TopSourceIdx = E2TopSrcIdx;
-			Info.E1Alpha = CalcAlpha(e1bot, e1top, pt);
-			Info.E2Alpha = CalcAlpha(e2bot, e2top, pt);
+			Info.E1BotPointIdx = E1.BotPtIdx;
+			Info.E1BotSourceIdx = E1.BotSrcIdx;
+			Info.E1TopPointIdx = E1.TopPtIdx;
+			Info.E1TopSourceIdx = E1.TopSrcIdx;
+			Info.E2BotPointIdx = E2.BotPtIdx;
+			Info.E2BotSourceIdx = E2.BotSrcIdx;
+			Info.E2TopPointIdx = E2.TopPtIdx;
+			Info.E2TopSourceIdx = E2.TopSrcIdx;
+			Info.E1Alpha = CalcAlpha(E1.Bot, E1.Top, pt);
+			Info.E2Alpha = CalcAlpha(E2.Bot, E2.Top, pt);
+			Info.E1Bot = E1.Bot;
+			Info.E1Top = E1.Top;
+			Info.E2Bot = E2.Bot;
+			Info.E2Top = E2.Top;
 
 			// Store intersection info
 			Group->AddIntersectionBlendInfo(pt.x, pt.y, Info);
@@ -1031,6 +1256,23 @@ void FPCGExClipper2ProcessorElement::BuildProcessingGroups(
 		}
 	}
 
+	// Groups matched against the exact same operands share a single pre-operation union of those
+	TMap<uint32, TSharedPtr<PCGExClipper2::FSharedUnion>> SharedUnions;
+	auto GetSharedUnion = [&](const TArray<int32>& InOperandIndices) -> TSharedPtr<PCGExClipper2::FSharedUnion>
+	{
+		TArray<int32> SortedIndices = InOperandIndices;
+		SortedIndices.Sort();
+
+		const uint32 Hash = FCrc::MemCrc32(SortedIndices.GetData(), SortedIndices.Num() * sizeof(int32));
+		if (const TSharedPtr<PCGExClipper2::FSharedUnion>* Existing = SharedUnions.Find(Hash))
+		{
+			// Hash collision between different sets, don't share
+			return (*Existing)->Indices == SortedIndices ? *Existing : nullptr;
+		}
+
+		return SharedUnions.Add(Hash, MakeShared<PCGExClipper2::FSharedUnion>(SortedIndices));
+	};
+
 	// Build processing groups
 	Context->ProcessingGroups.Reserve(MainPartitions.Num());
 
@@ -1044,6 +1286,8 @@ void FPCGExClipper2ProcessorElement::BuildProcessingGroups(
 		Group->Prepare(Context->AllOpData);
 		Context->CarryOverDetails.Prune(Group->GroupTags.Get());
 
+		if (Settings->bUnionOperandsBeforeOperation && Group->OperandPaths.size() > 1) { Group->SharedOperandUnion = GetSharedUnion(Group->OperandIndices); }
+
 		if (Group->IsValid()) { Context->ProcessingGroups.Add(Group); }
 	}
 }
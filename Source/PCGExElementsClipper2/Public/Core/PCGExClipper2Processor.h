@@ -131,6 +131,12 @@ namespace PCGExClipper2
 		// Alpha along each edge (0-1)
 		double E1Alpha = 0.5;
 		double E2Alpha = 0.5;
+
+		// Original edges endpoints, in clipper space; used to trace back edges that start or end on a previous intersection
+		PCGExClipper2Lib::Point64 E1Bot;
+		PCGExClipper2Lib::Point64 E1Top;
+		PCGExClipper2Lib::Point64 E2Bot;
+		PCGExClipper2Lib::Point64 E2Top;
 	};
 
 	class PCGEXELEMENTSCLIPPER2_API FOpData : public TSharedFromThis<FOpData>
@@ -150,6 +156,39 @@ namespace PCGExClipper2
 		int32 Num() const { return Facades.Num(); }
 	};
 
+	/**
+	 * NonZero union of closed paths.
+	 * When parallel, paths are ordered along a Morton curve of their bounds' center, unioned concurrently in spatially
+	 * coherent tiles, and tile results are then merged pairwise, concurrently, until a single solution remains.
+	 * This is only equivalent to a flat NonZero union when all paths wind the same way, otherwise a single pass is used.
+	 * Open paths are only fed to the final merge, as they don't contribute to a closed solution.
+	 */
+	PCGEXELEMENTSCLIPPER2_API void UnionPaths(
+		const PCGExClipper2Lib::Paths64& InPaths,
+		const PCGExClipper2Lib::Paths64& InOpenPaths,
+		const PCGExClipper2Lib::ZCallback64& InZCallback,
+		PCGExClipper2Lib::Paths64& OutUnion,
+		const bool bParallel);
+
+	struct FProcessingGroup;
+
+	/** Union of an operand set, computed once and shared by all the groups using that exact set */
+	struct FSharedUnion
+	{
+		TArray<int32> Indices;
+
+		FCriticalSection Lock;
+		bool bDone = false;
+
+		PCGExClipper2Lib::Paths64 Paths;
+		TSharedPtr<FProcessingGroup> IntersectionsOwner; // Holds intersection blend infos created by the union
+
+		explicit FSharedUnion(const TArray<int32>& InIndices)
+			: Indices(InIndices)
+		{
+		}
+	};
+
 	/**
 	 * Unified processing group that encapsulates subjects, operands, and cached data.
 	 * This provides a clean interface for Clipper2 operations.
@@ -171,6 +210,9 @@ namespace PCGExClipper2
 		TArray<int32> AllSourceIndices;
 		TSharedPtr<PCGExData::FTags> GroupTags;
 
+		// Operands union, shared with other groups using the same operands
+		TSharedPtr<FSharedUnion> SharedOperandUnion;
+
 		// Intersection blend info map: keyed by encoded (x,y) position
 		TMap<uint64, FIntersectionBlendInfo> IntersectionBlendInfos;
 		mutable FCriticalSection IntersectionLock;
@@ -282,6 +324,10 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_NotOverridable), AdvancedDisplay)
 	bool bUnionOperandsBeforeOperation = false;
 
+	/** If enabled, pre-operation unions of many paths are split into spatial tiles that are unioned in parallel, then merged as a tree. Only applies when all paths share the same winding, otherwise falls back to a single union. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_NotOverridable, EditCondition="bUnionGroupBeforeOperation || bUnionOperandsBeforeOperation"), AdvancedDisplay)
+	bool bParallelUnion = false;
+
 	UFUNCTION()
 	virtual bool WantsDataMatching() const;
 
@@ -234,9 +234,18 @@ namespace PCGExBuildDelaunayGraph
 
 		Delaunay = MakeShared<PCGExMath::Geo::TDelaunay3>();
 
+		// Sites are only needed to output them or to find the longest edges
 		bool bProcessed = false;
-		if (Settings->bMarkHull) { bProcessed = Delaunay->Process<false, true>(ActivePositions); }
-		else { bProcessed = Delaunay->Process<false, false>(ActivePositions); }
+		if (Settings->bOutputSites || Settings->bUrquhart)
+		{
+			if (Settings->bMarkHull) { bProcessed = Delaunay->Process<false, true>(ActivePositions); }
+			else { bProcessed = Delaunay->Process<false, false>(ActivePositions); }
+		}
+		else
+		{
+			if (Settings->bMarkHull) { bProcessed = Delaunay->ProcessEdges<true>(ActivePositions); }
+			else { bProcessed = Delaunay->ProcessEdges<false>(ActivePositions); }
+		}
 
 		if (!bProcessed)
 		{
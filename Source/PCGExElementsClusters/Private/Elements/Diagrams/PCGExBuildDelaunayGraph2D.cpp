@@ -301,7 +301,9 @@ namespace PCGExBuildDelaunayGraph2D
 
 		Delaunay = MakeShared<PCGExMath::Geo::TDelaunay2>();
 
-		if (!Delaunay->Process(ActivePositions, ProjectionDetails))
+		// Sites are only needed to output them or to find the longest edges
+		const bool bNeedsSites = Settings->bOutputSites || Settings->bUrquhart;
+		if (bNeedsSites ? !Delaunay->Process(ActivePositions, ProjectionDetails) : !Delaunay->ProcessEdges(ActivePositions, ProjectionDetails))
 		{
 			PCGE_LOG_C(Warning, GraphAndLog, ExecutionContext, FTEXT("Some inputs generated invalid results."));
 			return false;
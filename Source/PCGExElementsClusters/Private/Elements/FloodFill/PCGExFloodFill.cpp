@@ -16,6 +16,30 @@
 
 namespace PCGExFloodFill
 {
+	namespace Frontier
+	{
+		// Whether A should be captured before B; node index only breaks exact ties so order stays deterministic
+		struct FHeuristicsFirst
+		{
+			FORCEINLINE bool operator()(const FCandidate& A, const FCandidate& B) const
+			{
+				if (A.Score != B.Score) { return A.Score < B.Score; }
+				if (A.Depth != B.Depth) { return A.Depth < B.Depth; }
+				return A.Node->Index < B.Node->Index;
+			}
+		};
+
+		struct FDepthFirst
+		{
+			FORCEINLINE bool operator()(const FCandidate& A, const FCandidate& B) const
+			{
+				if (A.Depth != B.Depth) { return A.Depth < B.Depth; }
+				if (A.Score != B.Score) { return A.Score < B.Score; }
+				return A.Node->Index < B.Node->Index;
+			}
+		};
+	}
+
 	FDiffusion::FDiffusion(const TSharedPtr<FFillControlsHandler>& InFillControlsHandler, const TSharedPtr<PCGExClusters::FCluster>& InCluster, const PCGExClusters::FNode* InSeedNode)
 		: FillControlsHandler(InFillControlsHandler), SeedNode(InSeedNode), Cluster(InCluster)
 	{
@@ -60,7 +84,7 @@ namespace PCGExFloodFill
 
 		FVector FromPosition = Cluster->GetPos(FromNode);
 
-		for (const PCGExGraphs::FLink& Lk : FromNode.Links)
+		for (const PCGExGraphs::FLink Lk : Cluster->GetLinks(FromNode.Index))
 		{
 			PCGExClusters::FNode* OtherNode = Cluster->GetNode(Lk);
 			Visited.Add(OtherNode->Index, &bIsAlreadyInSet);
@@ -101,44 +125,78 @@ namespace PCGExFloodFill
 			if (FillControlsHandler->IsValidCandidate(this, From, Candidate))
 			{
 				// Valid candidate
-				Candidates.Add(Candidate);
+				if (!bHeapFrontier) { Candidates.Add(Candidate); }
+				else if (FillControlsHandler->Sorting == EPCGExFloodFillPrioritization::Heuristics) { Candidates.HeapPush(Candidate, Frontier::FHeuristicsFirst()); }
+				else { Candidates.HeapPush(Candidate, Frontier::FDepthFirst()); }
 			}
 		}
 	}
 
+	FCandidate FDiffusion::PopCandidate()
+	{
+		// Seed neighbors are consumed in discovery order until the first capture turns the frontier into a heap
+		FCandidate Candidate;
+		if (!bHeapFrontier) { Candidate = Candidates.Pop(EAllowShrinking::No); }
+		else if (FillControlsHandler->Sorting == EPCGExFloodFillPrioritization::Heuristics) { Candidates.HeapPop(Candidate, Frontier::FHeuristicsFirst(), EAllowShrinking::No); }
+		else { Candidates.HeapPop(Candidate, Frontier::FDepthFirst(), EAllowShrinking::No); }
+		return Candidate;
+	}
+
 	void FDiffusion::Grow()
 	{
 		if (bStopped) { return; }
 
-		bool bSearch = true;
-		while (bSearch)
+		while (!Candidates.IsEmpty())
 		{
-			if (Candidates.IsEmpty())
-			{
-				bStopped = true;
-				break;
-			}
+			const FCandidate Candidate = PopCandidate();
+			if (!FillControlsHandler->TryCapture(this, Candidate)) { continue; }
 
-			FCandidate Candidate = Candidates.Pop(EAllowShrinking::No);
+			Capture(Candidate);
+			return;
+		}
 
-			if (!FillControlsHandler->TryCapture(this, Candidate)) { continue; }
+		bStopped = true;
+	}
 
-			// Update max depth & max distance
-			MaxDepth = FMath::Max(MaxDepth, Candidate.Depth);
-			MaxDistance = FMath::Max(MaxDistance, Candidate.PathDistance);
+	bool FDiffusion::Propose(FCandidate& OutCandidate, const TArray<int32>& InClaims, const int32 InOrder)
+	{
+		if (bStopped) { return false; }
 
-			FCandidate& CapturedCandidate = Captured.Add_GetRef(Candidate);
-			CapturedCandidate.CaptureIndex = Captured.Num() - 1;
+		const int8* Influences = FillControlsHandler->InfluencesCount->GetData();
 
-			TravelStack->Set(Candidate.Node->Index, PCGEx::NH64(Candidate.Link.Node, Candidate.Link.Edge));
+		while (!Candidates.IsEmpty())
+		{
+			OutCandidate = PopCandidate();
 
-			Endpoints.Add(CapturedCandidate.CaptureIndex);
-			Endpoints.Remove(Candidate.CaptureIndex);
+			// Already claimed by another diffusion in a previous round
+			if (Influences[OutCandidate.Node->PointIndex] == 1) { continue; }
 
-			PostGrow();
+			// Claimed this round by a diffusion whose turn comes first
+			if (const int32 Claim = InClaims[OutCandidate.Node->Index]; Claim != -1 && Claim < InOrder) { continue; }
+			if (!FillControlsHandler->IsValidCapture(this, OutCandidate)) { continue; }
 
-			bSearch = false;
+			return true;
 		}
+
+		bStopped = true;
+		return false;
+	}
+
+	void FDiffusion::Capture(const FCandidate& Candidate)
+	{
+		// Update max depth & max distance
+		MaxDepth = FMath::Max(MaxDepth, Candidate.Depth);
+		MaxDistance = FMath::Max(MaxDistance, Candidate.PathDistance);
+
+		FCandidate& CapturedCandidate = Captured.Add_GetRef(Candidate);
+		CapturedCandidate.CaptureIndex = Captured.Num() - 1;
+
+		TravelStack->Set(Candidate.Node->Index, PCGEx::NH64(Candidate.Link.Node, Candidate.Link.Edge));
+
+		Endpoints.Add(CapturedCandidate.CaptureIndex);
+		Endpoints.Remove(Candidate.CaptureIndex);
+
+		PostGrow();
 	}
 
 	void FDiffusion::PostGrow()
@@ -147,21 +205,15 @@ namespace PCGExFloodFill
 
 		Probe(Captured.Last());
 
-		// Sort candidates
+		if (bHeapFrontier) { return; }
 
+		// First growth, heapify once; later candidates are pushed in place
+		bHeapFrontier = true;
 		switch (FillControlsHandler->Sorting)
 		{
-		case EPCGExFloodFillPrioritization::Heuristics: Candidates.Sort([&](const FCandidate& A, const FCandidate& B)
-			{
-				if (A.Score == B.Score) { return A.Depth > B.Depth; }
-				return A.Score > B.Score;
-			});
+		case EPCGExFloodFillPrioritization::Heuristics: Candidates.Heapify(Frontier::FHeuristicsFirst());
 			break;
-		case EPCGExFloodFillPrioritization::Depth: Candidates.Sort([&](const FCandidate& A, const FCandidate& B)
-			{
-				if (A.Depth == B.Depth) { return A.Score > B.Score; }
-				return A.Depth > B.Depth;
-			});
+		case EPCGExFloodFillPrioritization::Depth: Candidates.Heapify(Frontier::FDepthFirst());
 			break;
 		}
 	}
@@ -189,6 +241,8 @@ namespace PCGExFloodFill
 	FFillControlsHandler::FFillControlsHandler(FPCGExContext* InContext, const TSharedPtr<PCGExClusters::FCluster>& InCluster, const TSharedPtr<PCGExData::FFacade>& InVtxDataCache, const TSharedPtr<PCGExData::FFacade>& InEdgeDataCache, const TSharedPtr<PCGExData::FFacade>& InSeedsDataCache, const TArray<TObjectPtr<const UPCGExFillControlsFactoryData>>& InFactories)
 		: ExecutionContext(InContext), Cluster(InCluster), VtxDataFacade(InVtxDataCache), EdgeDataFacade(InEdgeDataCache), SeedsDataFacade(InSeedsDataCache)
 	{
+		// Diffusions hammer the adjacency, pack it once up-front
+		Cluster->GetCSR();
 		bIsValidHandler = BuildFrom(InContext, InFactories);
 	}
 
@@ -253,11 +307,17 @@ namespace PCGExFloodFill
 
 	bool FFillControlsHandler::TryCapture(const FDiffusion* Diffusion, const FCandidate& Candidate)
 	{
-		for (const TSharedPtr<FPCGExFillControlOperation>& Op : SubOpsCapture) { if (!Op->IsValidCapture(Diffusion, Candidate)) { return false; } }
+		if (!IsValidCapture(Diffusion, Candidate)) { return false; }
 		if (FPlatformAtomics::InterlockedCompareExchange((InfluencesCount->GetData() + Candidate.Node->PointIndex), 1, 0) == 1) { return false; }
 		return true;
 	}
 
+	bool FFillControlsHandler::IsValidCapture(const FDiffusion* Diffusion, const FCandidate& Candidate)
+	{
+		for (const TSharedPtr<FPCGExFillControlOperation>& Op : SubOpsCapture) { if (!Op->IsValidCapture(Diffusion, Candidate)) { return false; } }
+		return true;
+	}
+
 	bool FFillControlsHandler::IsValidProbe(const FDiffusion* Diffusion, const FCandidate& Candidate)
 	{
 		for (const TSharedPtr<FPCGExFillControlOperation>& Op : SubOpsProbe) { if (!Op->IsValidProbe(Diffusion, Candidate)) { return false; } }
@@ -211,7 +211,12 @@ namespace PCGExClusterDiffusion
 
 		Diffusions.Reserve(OngoingDiffusions.Num());
 
-		if (Settings->Processing == EPCGExFloodFillProcessing::Parallel)
+		if (Settings->Processing == EPCGExFloodFillProcessing::Rounds)
+		{
+			RoundClaims.Init(-1, Cluster->Nodes->Num());
+			StartRound();
+		}
+		else if (Settings->Processing == EPCGExFloodFillProcessing::Parallel)
 		{
 			Grow();
 		}
@@ -261,6 +266,203 @@ namespace PCGExClusterDiffusion
 	void FProcessor::OnRangeProcessingComplete()
 	{
 		// A single growth iteration pass is complete
+		CollectStoppedDiffusions();
+
+		if (OngoingDiffusions.IsEmpty()) { return; }
+
+		Grow();
+	}
+
+	void FProcessor::StartRound()
+	{
+		// Rounds reproduce a single-threaded lockstep pass: at each step, ongoing diffusions take turns in order
+		// and capture their best node that isn't owned yet. A diffusion takes part in as many steps per pass as its fill rate.
+		// Each round is one such step, computed concurrently :
+		// - Pending diffusions propose their best candidate, skipping nodes owned or claimed by a diffusion that comes first
+		// - Claims are settled in diffusion order; a diffusion that comes first takes the node over and the previous claimant goes back to pending
+		// - Once nothing is pending, each claim is exactly what the diffusion would have captured on its turn, and is committed
+		// Claims only ever move to a diffusion that comes first, so a candidate dropped along the way is owned by someone earlier in the turn order.
+
+		do
+		{
+			if (!TaskManager->IsAvailable()) { return; }
+
+			RoundProposals.SetNum(OngoingDiffusions.Num());
+			RoundPending.SetNumUninitialized(OngoingDiffusions.Num());
+			for (int32 i = 0; i < OngoingDiffusions.Num(); i++)
+			{
+				RoundProposals[i].Node = nullptr;
+				RoundPending[i] = i;
+			}
+
+			if (!ResumeRound()) { return; }
+		}
+		while (AdvanceRound());
+	}
+
+	bool FProcessor::ResumeRound()
+	{
+		// When there are only a few pending proposals or winners, task dispatches cost more than the work itself, run those inline.
+		const int32 ChunkSize = PCGEX_CORE_SETTINGS.GetClusterBatchChunkSize();
+
+		while (!RoundPending.IsEmpty())
+		{
+			if (RoundPending.Num() > ChunkSize)
+			{
+				PCGEX_ASYNC_GROUP_CHKD(TaskManager, ProposeCaptures)
+
+				ProposeCaptures->OnCompleteCallback = [PCGEX_ASYNC_THIS_CAPTURE]()
+				{
+					PCGEX_ASYNC_THIS
+					This->ResolvePending();
+					if (This->ResumeRound()) { This->CompleteRound(); }
+				};
+
+				ProposeCaptures->OnSubLoopStartCallback = [PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+				{
+					PCGEX_ASYNC_THIS
+					This->ProposeScope(Scope);
+				};
+
+				ProposeCaptures->StartSubLoops(RoundPending.Num(), ChunkSize);
+				return false;
+			}
+
+			if (!TaskManager->IsAvailable()) { return false; }
+
+			ProposeScope(PCGExMT::FScope(0, RoundPending.Num()));
+			ResolvePending();
+		}
+
+		CollectWinners();
+
+		if (RoundWinners.Num() > ChunkSize)
+		{
+			PCGEX_ASYNC_GROUP_CHKD(TaskManager, CommitCaptures)
+
+			CommitCaptures->OnCompleteCallback = [PCGEX_ASYNC_THIS_CAPTURE]()
+			{
+				PCGEX_ASYNC_THIS
+				This->CompleteRound();
+			};
+
+			CommitCaptures->OnSubLoopStartCallback = [PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
+			{
+				PCGEX_ASYNC_THIS
+				This->CommitScope(Scope);
+			};
+
+			CommitCaptures->StartSubLoops(RoundWinners.Num(), ChunkSize);
+			return false;
+		}
+
+		if (!RoundWinners.IsEmpty()) { CommitScope(PCGExMT::FScope(0, RoundWinners.Num())); }
+		return true;
+	}
+
+	void FProcessor::ProposeScope(const PCGExMT::FScope& Scope)
+	{
+		// Claims are only written while resolving, so they can be read freely here
+		PCGEX_SCOPE_LOOP(PendingIndex)
+		{
+			const int32 Index = RoundPending[PendingIndex];
+
+			PCGExFloodFill::FCandidate& Proposal = RoundProposals[Index];
+			Proposal.Node = nullptr;
+
+			const TSharedPtr<PCGExFloodFill::FDiffusion>& Diffusion = OngoingDiffusions[Index];
+			const int32 CurrentFillRate = FillRate->Read(Diffusion->GetSettingsIndex(Settings->Diffusion.FillRateSource));
+
+			// Zero fill rate won't ever grow
+			if (CurrentFillRate <= 0) { Diffusion->bStopped = true; }
+			if (RoundStep >= CurrentFillRate) { continue; }
+
+			if (!Diffusion->Propose(Proposal, RoundClaims, Index)) { Proposal.Node = nullptr; }
+		}
+	}
+
+	void FProcessor::ResolvePending()
+	{
+		// Sequential & in diffusion order, so the outcome only depends on proposals
+		TArray<int32> NextPending;
+
+		for (const int32 Index : RoundPending)
+		{
+			const PCGExFloodFill::FCandidate& Proposal = RoundProposals[Index];
+			if (!Proposal.Node) { continue; }
+
+			int32& Claim = RoundClaims[Proposal.Node->Index];
+
+			if (Claim == -1)
+			{
+				Claim = Index;
+			}
+			else if (Claim < Index)
+			{
+				// Claimed during this resolve by a diffusion that comes first, try again with the next candidate
+				RoundProposals[Index].Node = nullptr;
+				NextPending.Add(Index);
+			}
+			else
+			{
+				// Take the node over, previous claimant tries again with its next candidate
+				RoundProposals[Claim].Node = nullptr;
+				NextPending.Add(Claim);
+				Claim = Index;
+			}
+		}
+
+		NextPending.Sort();
+		RoundPending = MoveTemp(NextPending);
+	}
+
+	void FProcessor::CollectWinners()
+	{
+		RoundWinners.Reset();
+
+		int8* Influences = InfluencesCount->GetData();
+		for (int32 i = 0; i < RoundProposals.Num(); i++)
+		{
+			const PCGExFloodFill::FCandidate& Proposal = RoundProposals[i];
+			if (!Proposal.Node) { continue; }
+
+			RoundClaims[Proposal.Node->Index] = -1;
+			Influences[Proposal.Node->PointIndex] = 1;
+			RoundWinners.Add(i);
+		}
+	}
+
+	void FProcessor::CommitScope(const PCGExMT::FScope& Scope)
+	{
+		PCGEX_SCOPE_LOOP(i)
+		{
+			const int32 Index = RoundWinners[i];
+			OngoingDiffusions[Index]->Capture(RoundProposals[Index]);
+		}
+	}
+
+	void FProcessor::CompleteRound()
+	{
+		if (AdvanceRound()) { StartRound(); }
+	}
+
+	bool FProcessor::AdvanceRound()
+	{
+		if (!RoundWinners.IsEmpty())
+		{
+			RoundStep++;
+			return true;
+		}
+
+		// Nothing left to capture at this step, the pass is complete
+		RoundStep = 0;
+		CollectStoppedDiffusions();
+
+		return !OngoingDiffusions.IsEmpty();
+	}
+
+	void FProcessor::CollectStoppedDiffusions()
+	{
 		const int32 OngoingNum = OngoingDiffusions.Num();
 
 		// Move stopped diffusions in another castle
@@ -273,10 +475,6 @@ namespace PCGExClusterDiffusion
 		}
 
 		OngoingDiffusions.SetNum(WriteIndex);
-
-		if (OngoingDiffusions.IsEmpty()) { return; }
-
-		Grow();
 	}
 
 	void FProcessor::CompleteWork()
@@ -494,6 +692,9 @@ namespace PCGExClusterDiffusion
 		InitialDiffusions.Reset();
 		OngoingDiffusions.Reset();
 		Diffusions.Reset();
+		RoundProposals.Empty();
+		RoundClaims.Empty();
+		RoundWinners.Empty();
 		FillControlsHandler.Reset();
 		BlendOpsManager.Reset();
 	}
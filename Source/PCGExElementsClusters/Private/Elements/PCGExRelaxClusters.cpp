@@ -5,13 +5,13 @@
 
 
 #include "PCGParamData.h"
+#include "Async/ParallelFor.h"
 #include "Containers/PCGExScopedContainers.h"
 #include "Data/PCGExData.h"
 #include "Elements/Relax/PCGExRelaxClusterOperation.h"
 #include "Core/PCGExPointFilter.h"
 #include "Details/PCGExInfluenceDetails.h"
 #include "Core/PCGExClusterFilter.h"
-#include "Types/PCGExTypeOpsRotation.h"
 
 #define LOCTEXT_NAMESPACE "PCGExRelaxClusters"
 #define PCGEX_NAMESPACE RelaxClusters
@@ -98,19 +98,20 @@ namespace PCGExRelaxClusters
 		RelaxOperation->SecondaryDataFacade = EdgeDataFacade;
 
 
-		PrimaryBuffer = MakeShared<TArray<FTransform>>();
-		SecondaryBuffer = MakeShared<TArray<FTransform>>();
+		// Relaxing only ever moves points, so iterations operate on positions alone
+		PrimaryBuffer = MakeShared<TArray<FVector>>();
+		SecondaryBuffer = MakeShared<TArray<FVector>>();
 
-		PrimaryBuffer->Init(FTransform::Identity, NumNodes);
-		SecondaryBuffer->Init(FTransform::Identity, NumNodes);
+		PrimaryBuffer->SetNumUninitialized(NumNodes);
+		SecondaryBuffer->SetNumUninitialized(NumNodes);
 
-		TArray<FTransform>& PBufferRef = (*PrimaryBuffer);
-		TArray<FTransform>& SBufferRef = (*SecondaryBuffer);
+		TArray<FVector>& PBufferRef = (*PrimaryBuffer);
+		TArray<FVector>& SBufferRef = (*SecondaryBuffer);
 
-		TArray<PCGExClusters::FNode> NodesRef = *Cluster->Nodes.Get();
+		const TArray<PCGExClusters::FNode>& NodesRef = *Cluster->Nodes.Get();
 		TConstPCGValueRange<FTransform> InTransforms = VtxDataFacade->GetIn()->GetConstTransformValueRange();
 
-		for (int i = 0; i < NumNodes; i++) { PBufferRef[i] = SBufferRef[i] = InTransforms[NodesRef[i].PointIndex]; }
+		for (int i = 0; i < NumNodes; i++) { PBufferRef[i] = SBufferRef[i] = InTransforms[NodesRef[i].PointIndex].GetLocation(); }
 
 		RelaxOperation->ReadBuffer = PrimaryBuffer.Get();
 		RelaxOperation->WriteBuffer = SecondaryBuffer.Get();
@@ -118,6 +119,7 @@ namespace PCGExRelaxClusters
 		if (!RelaxOperation->PrepareForCluster(ExecutionContext, Cluster)) { return false; }
 
 		Iterations = Settings->Iterations;
+		if (Settings->bStopOnConvergence) { ConvergenceThresholdSquared = FMath::Square(Settings->ConvergenceThreshold); }
 
 		Steps = RelaxOperation->GetNumSteps();
 		CurrentStep = -1;
@@ -129,7 +131,7 @@ namespace PCGExRelaxClusters
 			VtxTesting->OnCompleteCallback = [PCGEX_ASYNC_THIS_CAPTURE]()
 			{
 				PCGEX_ASYNC_THIS
-				This->StartNextStep();
+				This->StartRelaxing();
 			};
 
 			VtxTesting->OnSubLoopStartCallback = [PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
@@ -142,12 +144,37 @@ namespace PCGExRelaxClusters
 		}
 		else
 		{
-			StartNextStep();
+			StartRelaxing();
 		}
 
 		return true;
 	}
 
+	void FProcessor::StartRelaxing()
+	{
+		if (!Settings->bPersistentIterations)
+		{
+			StartNextStep();
+			return;
+		}
+
+		PCGEX_ASYNC_GROUP_CHKD_VOID(TaskManager, RelaxTask)
+
+		RelaxTask->OnCompleteCallback = [PCGEX_ASYNC_THIS_CAPTURE]()
+		{
+			PCGEX_ASYNC_THIS
+			This->StartParallelLoopForNodes();
+		};
+
+		RelaxTask->AddSimpleCallback([PCGEX_ASYNC_THIS_CAPTURE]()
+		{
+			PCGEX_ASYNC_THIS
+			This->RunIterations();
+		});
+
+		RelaxTask->StartSimpleCallbacks();
+	}
+
 	void FProcessor::StartNextStep()
 	{
 		CurrentStep++;
@@ -161,6 +188,12 @@ namespace PCGExRelaxClusters
 
 		if (CurrentStep > Steps)
 		{
+			if (HasConverged())
+			{
+				StartParallelLoopForNodes();
+				return;
+			}
+
 			Iterations--;
 			CurrentStep = 0;
 		}
@@ -190,12 +223,72 @@ namespace PCGExRelaxClusters
 		}
 	}
 
+	void FProcessor::RunIterations()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExRelaxClusters::RunIterations);
+
+		// Same work as StartNextStep, but every step of every iteration runs from this single task;
+		// each ParallelFor join acts as the barrier between steps.
+		// The task manager is polled between steps so a cancelled execution doesn't have to wait for every iteration.
+
+		constexpr int32 ChunkSize = 256;
+
+		auto IsCancelled = [&]() { return !TaskManager || !TaskManager->IsAvailable(); };
+
+		for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+		{
+			for (CurrentStep = 0; CurrentStep < Steps; CurrentStep++)
+			{
+				if (IsCancelled()) { return; }
+
+				StepSource = RelaxOperation->PrepareNextStep(CurrentStep);
+
+				const int32 NumItems = StepSource == EPCGExClusterElement::Vtx ? NumNodes : NumEdges;
+				const int32 NumChunks = FMath::DivideAndRoundUp(NumItems, ChunkSize);
+
+				ParallelFor(NumChunks, [&](const int32 Chunk)
+				{
+					const int32 Start = Chunk * ChunkSize;
+					RelaxScope(PCGExMT::FScope(Start, FMath::Min(ChunkSize, NumItems - Start), Chunk));
+				});
+			}
+
+			if (HasConverged()) { break; }
+		}
+	}
+
+	bool FProcessor::HasConverged() const
+	{
+		if (ConvergenceThresholdSquared < 0) { return false; }
+
+		// Read buffer holds the positions from before the last iteration, write buffer the new ones
+		const TArray<FVector>& RBufferRef = (*RelaxOperation->ReadBuffer);
+		const TArray<FVector>& WBufferRef = (*RelaxOperation->WriteBuffer);
+
+		constexpr int32 ChunkSize = 4096;
+		const int32 NumChunks = FMath::DivideAndRoundUp(NumNodes, ChunkSize);
+
+		TArray<double> ChunkMax;
+		ChunkMax.Init(0, NumChunks);
+
+		ParallelFor(NumChunks, [&](const int32 Chunk)
+		{
+			const int32 End = FMath::Min(NumNodes, (Chunk + 1) * ChunkSize);
+			double Max = 0;
+			for (int32 i = Chunk * ChunkSize; i < End; i++) { Max = FMath::Max(Max, FVector::DistSquared(RBufferRef[i], WBufferRef[i])); }
+			ChunkMax[Chunk] = Max;
+		});
+
+		for (const double Max : ChunkMax) { if (Max > ConvergenceThresholdSquared) { return false; } }
+		return true;
+	}
+
 	void FProcessor::RelaxScope(const PCGExMT::FScope& Scope) const
 	{
-		const TArray<FTransform>& RBufferRef = (*RelaxOperation->ReadBuffer);
-		TArray<FTransform>& WBufferRef = (*RelaxOperation->WriteBuffer);
+		const TArray<FVector>& RBufferRef = (*RelaxOperation->ReadBuffer);
+		TArray<FVector>& WBufferRef = (*RelaxOperation->WriteBuffer);
 
-#define PCGEX_RELAX_PROGRESS  WBufferRef[i] = PCGExTypeOps::FTypeOps<FTransform>::Lerp( RBufferRef[i], WBufferRef[i], InfluenceDetails.GetInfluence(Node.PointIndex));
+#define PCGEX_RELAX_PROGRESS  WBufferRef[i] = FMath::Lerp( RBufferRef[i], WBufferRef[i], InfluenceDetails.GetInfluence(Node.PointIndex));
 #define PCGEX_RELAX_FILTER if(!IsNodePassingFilters(Node)){ WBufferRef[i] = RBufferRef[i]; }else
 #define PCGEX_RELAX_STEP_NODE(_STEP) if (CurrentStep == _STEP-1){\
 		if(bLastStep){ \
@@ -238,19 +331,20 @@ namespace PCGExRelaxClusters
 
 		TPCGValueRange<FTransform> OutTransforms = VtxDataFacade->GetOut()->GetTransformValueRange(false);
 
-		TArray<FTransform>& WBufferRef = (*RelaxOperation->WriteBuffer);
+		TArray<FVector>& WBufferRef = (*RelaxOperation->WriteBuffer);
 
 		PCGEX_SCOPE_LOOP(Index)
 		{
 			PCGExClusters::FNode& Node = Nodes[Index];
+			FTransform& OutTransform = OutTransforms[Node.PointIndex];
 
 			if (!InfluenceDetails.bProgressiveInfluence)
 			{
-				OutTransforms[Node.PointIndex] = PCGExTypeOps::FTypeOps<FTransform>::Lerp(OutTransforms[Node.PointIndex], WBufferRef[Node.Index], InfluenceDetails.GetInfluence(Node.PointIndex));
+				OutTransform.SetLocation(FMath::Lerp(OutTransform.GetLocation(), WBufferRef[Node.Index], InfluenceDetails.GetInfluence(Node.PointIndex)));
 			}
 			else
 			{
-				OutTransforms[Node.PointIndex] = WBufferRef[Node.Index];
+				OutTransform.SetLocation(WBufferRef[Node.Index]);
 			}
 
 			const FVector DirectionAndSize = OutTransforms[Node.PointIndex].GetLocation() - Cluster->GetPos(Node.Index);
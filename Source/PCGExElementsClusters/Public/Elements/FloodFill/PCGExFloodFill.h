@@ -123,8 +123,13 @@ namespace PCGExFloodFill
 		int32 MaxDepth = 0;
 		double MaxDistance = 0;
 
+		// Candidates are kept as a binary heap once growth has started
+		bool bHeapFrontier = false;
+
 		TSharedPtr<FFillControlsHandler> FillControlsHandler;
 
+		FCandidate PopCandidate();
+
 	public:
 		int32 Index = -1;
 		bool bStopped = false;
@@ -135,7 +140,7 @@ namespace PCGExFloodFill
 		TSharedPtr<PCGEx::FHashLookupMap> TravelStack; // Required for FillControls & Heuristics
 		TSharedPtr<PCGExClusters::FCluster> Cluster;
 
-		TArray<FCandidate> Candidates;
+		TArray<FCandidate> Candidates; // Frontier, see bHeapFrontier
 		TArray<FCandidate> Captured;
 
 		FDiffusion(const TSharedPtr<FFillControlsHandler>& InFillControlsHandler, const TSharedPtr<PCGExClusters::FCluster>& InCluster, const PCGExClusters::FNode* InSeedNode);
@@ -148,6 +153,14 @@ namespace PCGExFloodFill
 		void Grow();
 		void PostGrow();
 
+		/**
+		 * Pops the best capturable candidate without claiming it; stops the diffusion if none is left.
+		 * @param InClaims Per node, order of the diffusion that claimed it this round, -1 if none. Nodes claimed by a diffusion ordered before InOrder are skipped.
+		 */
+		bool Propose(FCandidate& OutCandidate, const TArray<int32>& InClaims, const int32 InOrder);
+		/** Commits a capture previously returned by Propose or validated through TryCapture. */
+		void Capture(const FCandidate& Candidate);
+
 		void Diffuse(const TSharedPtr<PCGExData::FFacade>& InVtxFacade, const TSharedPtr<PCGExBlending::FBlendOpsManager>& InBlendOps, TArray<int32>& OutIndices);
 	};
 
@@ -197,6 +210,7 @@ namespace PCGExFloodFill
 		bool PrepareForDiffusions(const TArray<TSharedPtr<FDiffusion>>& Diffusions, const FPCGExFloodFillFlowDetails& Details);
 
 		bool TryCapture(const FDiffusion* Diffusion, const FCandidate& Candidate);
+		bool IsValidCapture(const FDiffusion* Diffusion, const FCandidate& Candidate);
 		bool IsValidProbe(const FDiffusion* Diffusion, const FCandidate& Candidate);
 		bool IsValidCandidate(const FDiffusion* Diffusion, const FCandidate& From, const FCandidate& Candidate);
 	};
@@ -32,6 +32,7 @@ enum class EPCGExFloodFillProcessing : uint8
 {
 	Parallel = 0 UMETA(DisplayName = "Parallel", ToolTip="Diffuse each vtx once before moving to the next iteration."),
 	Sequence = 1 UMETA(DisplayName = "Sequential", ToolTip="Diffuse each vtx until it stops before moving to the next one, and so on."),
+	Rounds   = 2 UMETA(DisplayName = "Rounds", ToolTip="Diffusions grow side by side, one capture per step, taking turns in seed order. Captures are proposed concurrently and contested nodes go to the diffusion whose turn comes first, while the others move on to their next candidate. Captures are exclusive, and the partition is the same as that single-threaded lockstep, regardless of thread scheduling."),
 };
 
 UENUM()
@@ -232,6 +233,13 @@ namespace PCGExClusterDiffusion
 
 		TSharedPtr<PCGExMT::TScopedNumericValue<double>> MaxDistanceValue;
 
+		// Rounds processing
+		int32 RoundStep = 0;
+		TArray<PCGExFloodFill::FCandidate> RoundProposals; // One per ongoing diffusion, Node == nullptr when there is none
+		TArray<int32> RoundClaims;                         // Per node, ongoing diffusion that currently holds it
+		TArray<int32> RoundPending;                        // Ongoing diffusions that still need to propose this round, in order
+		TArray<int32> RoundWinners;
+
 		int32 ExpectedPathCount = 0;
 
 	public:
@@ -250,6 +258,16 @@ namespace PCGExClusterDiffusion
 		void StartGrowth();
 		void Grow();
 
+		void StartRound();
+		bool ResumeRound();
+		void ProposeScope(const PCGExMT::FScope& Scope);
+		void ResolvePending();
+		void CollectWinners();
+		void CommitScope(const PCGExMT::FScope& Scope);
+		void CompleteRound();
+		bool AdvanceRound();
+		void CollectStoppedDiffusions();
+
 		virtual void ProcessRange(const PCGExMT::FScope& Scope) override;
 		virtual void OnRangeProcessingComplete() override;
 
@@ -50,6 +50,14 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, ClampMin=1))
 	int32 Iterations = 10;
 
+	/** Stop iterating early once no point moves more than the convergence threshold over a full iteration. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, InlineEditConditionToggle))
+	bool bStopOnConvergence = false;
+
+	/** Max point displacement over an iteration under which the relaxation is considered converged. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, EditCondition="bStopOnConvergence", ClampMin=0))
+	double ConvergenceThreshold = 0.01;
+
 	/** Influence Settings*/
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
 	FPCGExInfluenceDetails InfluenceDetails;
@@ -83,6 +91,11 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Outputs", meta=(DisplayName="Amplitude", PCG_Overridable, EditCondition="bWriteAmplitude"))
 	FName AmplitudeAttributeName = FName("Amplitude");
 
+	/** Run all iterations from a single long-lived task, with parallel loops joining between steps, instead of scheduling a new task group for every step of every iteration. Cancellation is still checked between steps.
+	 * Note that this runs exactly Iterations x Steps relaxation steps, which is not the exact step sequence of the default scheduler (it does an extra buffer swap and partial pass when wrapping iterations), so results will differ slightly. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_NotOverridable), AdvancedDisplay)
+	bool bPersistentIterations = false;
+
 private:
 	friend class FPCGExRelaxClustersElement;
 };
@@ -123,10 +136,11 @@ namespace PCGExRelaxClusters
 
 		UPCGExRelaxClusterOperation* RelaxOperation = nullptr;
 
-		TSharedPtr<TArray<FTransform>> PrimaryBuffer;
-		TSharedPtr<TArray<FTransform>> SecondaryBuffer;
+		TSharedPtr<TArray<FVector>> PrimaryBuffer;
+		TSharedPtr<TArray<FVector>> SecondaryBuffer;
 
 		FPCGExInfluenceDetails InfluenceDetails;
+		double ConvergenceThresholdSquared = -1;
 
 		TSharedPtr<PCGExMT::TScopedNumericValue<double>> MaxDistanceValue;
 
@@ -142,7 +156,10 @@ namespace PCGExRelaxClusters
 
 		virtual TSharedPtr<PCGExClusters::FCluster> HandleCachedCluster(const TSharedRef<PCGExClusters::FCluster>& InClusterRef) override;
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InTaskManager) override;
+		void StartRelaxing();
 		void StartNextStep();
+		void RunIterations();
+		bool HasConverged() const;
 		void RelaxScope(const PCGExMT::FScope& Scope) const;
 		virtual void PrepareLoopScopesForNodes(const TArray<PCGExMT::FScope>& Loops) override;
 		virtual void ProcessNodes(const PCGExMT::FScope& Scope) override;
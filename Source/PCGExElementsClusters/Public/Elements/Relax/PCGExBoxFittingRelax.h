@@ -31,7 +31,25 @@ public:
 	virtual bool PrepareForCluster(FPCGExContext* InContext, const TSharedPtr<PCGExClusters::FCluster>& InCluster) override
 	{
 		if (!Super::PrepareForCluster(InContext, InCluster)) { return false; }
-		PCGExArrayHelpers::InitArray(BoxBuffer, Cluster->Nodes->Num());
+		const int32 NumNodes = Cluster->Nodes->Num();
+		PCGExArrayHelpers::InitArray(BoxBuffer, NumNodes);
+		PCGExArrayHelpers::InitArray(LocalBoxes, NumNodes);
+
+		// Relaxing only moves points, so rotation & scale are baked once into origin-centered boxes
+		const UPCGBasePointData* InPointData = PrimaryDataFacade->GetIn();
+		const TConstPCGValueRange<FTransform> InTransforms = InPointData->GetConstTransformValueRange();
+
+		for (int i = 0; i < NumNodes; i++)
+		{
+			const int32 PointIndex = Cluster->GetNodePointIndex(i);
+			FTransform Transform = InTransforms[PointIndex];
+			Transform.SetLocation(FVector::ZeroVector);
+			LocalBoxes[i] = InPointData->GetLocalBounds(PointIndex).ExpandBy(Padding).TransformBy(Transform);
+		}
+
+		MaxReach = 0;
+		for (const FBox& Box : LocalBoxes) { MaxReach = FMath::Max3(MaxReach, Box.Min.GetAbsMax(), Box.Max.GetAbsMax()); }
+
 		return true;
 	}
 
@@ -41,50 +59,43 @@ public:
 		if (InStep == 0)
 		{
 			const int32 NumNodes = Cluster->Nodes->Num();
-			const UPCGBasePointData* InPointData = PrimaryDataFacade->GetIn();
-
-			for (int i = 0; i < NumNodes; i++)
-			{
-				BoxBuffer[i] = InPointData->GetLocalBounds(Cluster->GetNodePointIndex(i)).ExpandBy(Padding).TransformBy(*(ReadBuffer->GetData() + i));
-			}
+			for (int i = 0; i < NumNodes; i++) { BoxBuffer[i] = LocalBoxes[i].ShiftBy(*(ReadBuffer->GetData() + i)); }
 		}
 		return Source;
 	}
 
 	virtual void Step2(const PCGExClusters::FNode& Node) override
 	{
-		const FTransform& CurrentTr = *(ReadBuffer->GetData() + Node.Index);
 		const FBox CurrentBox = BoxBuffer[Node.Index];
-		const FVector& CurrentPos = CurrentTr.GetLocation();
+		const FVector& CurrentPos = *(ReadBuffer->GetData() + Node.Index);
 
-		// Apply repulsion forces between all pairs of nodes
-		const int32 NumNodes = Cluster->Nodes->Num();
-		for (int32 OtherNodeIndex = Node.Index + 1; OtherNodeIndex < NumNodes; OtherNodeIndex++)
+		// Apply repulsion forces between nearby pairs of nodes
+		ForEachRepulsionCandidate(Node.Index, [&](const int32 OtherNodeIndex)
 		{
-			const FTransform& OtherTr = *(ReadBuffer->GetData() + OtherNodeIndex);
 			const PCGExClusters::FNode* OtherNode = Cluster->GetNode(OtherNodeIndex);
-			const FVector& OtherPos = (ReadBuffer->GetData() + OtherNodeIndex)->GetLocation();
+			const FVector& OtherPos = *(ReadBuffer->GetData() + OtherNodeIndex);
 
 			// Transform boxes to world space
 			const FBox OtherBox = BoxBuffer[OtherNodeIndex];
 
 			// Check for overlap
-			if (!CurrentBox.Intersect(OtherBox)) { continue; }
+			if (!CurrentBox.Intersect(OtherBox)) { return; }
 
 			// Calculate overlap resolution force
 			// TODO : Test with repulsion based on overlap size
 			FVector Delta = OtherPos - CurrentPos;
 			const double Distance = Delta.Size();
 
-			if (Distance <= KINDA_SMALL_NUMBER) { continue; }
+			if (Distance <= KINDA_SMALL_NUMBER) { return; }
 
 			// Overlap resolution
 			FVector OverlapSize = CurrentBox.GetExtent() + OtherBox.GetExtent() - PCGExTypes::Abs(Delta);
 
 			AddDelta(OtherNode->Index, Node.Index, (RepulsionConstant * OverlapSize * (Delta / Distance)));
-		}
+		});
 	}
 
 protected:
 	TArray<FBox> BoxBuffer;
+	TArray<FBox> LocalBoxes;
 };
@@ -75,36 +75,39 @@ public:
 		ExtentsBuffer = GetValueSettingExtents();
 		if (!ExtentsBuffer->Init(PrimaryDataFacade)) { return false; }
 
+		MaxReach = 0;
+		for (const PCGExClusters::FNode& Node : *Cluster->Nodes) { MaxReach = FMath::Max(MaxReach, (ExtentsBuffer->Read(Node.PointIndex) + FVector(Padding)).GetAbsMax()); }
+
 		return true;
 	}
 
 	virtual void Step2(const PCGExClusters::FNode& Node) override
 	{
-		const FVector& CurrentPos = (ReadBuffer->GetData() + Node.Index)->GetLocation();
+		const FVector& CurrentPos = *(ReadBuffer->GetData() + Node.Index);
 		const FVector& CurrentExtents = ExtentsBuffer->Read(Node.PointIndex) + FVector(Padding);
 
 		// Build current node's bounds
 		const FBox CurrentBox(CurrentPos - CurrentExtents, CurrentPos + CurrentExtents);
 
-		// Apply repulsion forces between all pairs of nodes
-		for (int32 OtherNodeIndex = Node.Index + 1; OtherNodeIndex < Cluster->Nodes->Num(); OtherNodeIndex++)
+		// Apply repulsion forces between nearby pairs of nodes
+		ForEachRepulsionCandidate(Node.Index, [&](const int32 OtherNodeIndex)
 		{
 			const PCGExClusters::FNode* OtherNode = Cluster->GetNode(OtherNodeIndex);
-			const FVector& OtherPos = (ReadBuffer->GetData() + OtherNodeIndex)->GetLocation();
+			const FVector& OtherPos = *(ReadBuffer->GetData() + OtherNodeIndex);
 			const FVector& OtherExtents = ExtentsBuffer->Read(OtherNode->PointIndex) + FVector(Padding);
 
 			// Build other node's bounds
 			const FBox OtherBox(OtherPos - OtherExtents, OtherPos + OtherExtents);
 
 			// Check for overlap
-			if (!CurrentBox.Intersect(OtherBox)) { continue; }
+			if (!CurrentBox.Intersect(OtherBox)) { return; }
 
 			// Calculate overlap in each axis
 			const FVector OverlapMin = FVector::Max(CurrentBox.Min, OtherBox.Min);
 			const FVector OverlapMax = FVector::Min(CurrentBox.Max, OtherBox.Max);
 			const FVector OverlapSize = OverlapMax - OverlapMin;
 
-			if (OverlapSize.X <= 0 || OverlapSize.Y <= 0 || OverlapSize.Z <= 0) { continue; }
+			if (OverlapSize.X <= 0 || OverlapSize.Y <= 0 || OverlapSize.Z <= 0) { return; }
 
 			FVector SeparationDir;
 			double SeparationMagnitude;
@@ -126,10 +129,9 @@ public:
 				{
 					// Check if nodes are connected and use edge direction
 					bool bConnected = false;
-					for (const PCGExGraphs::FEdge& Edge : *Cluster->Edges)
+					for (const PCGExGraphs::FLink Lk : Cluster->GetLinks(Node.Index))
 					{
-						if ((Cluster->GetEdgeStart(Edge)->Index == Node.Index && Cluster->GetEdgeEnd(Edge)->Index == OtherNodeIndex) ||
-							(Cluster->GetEdgeStart(Edge)->Index == OtherNodeIndex && Cluster->GetEdgeEnd(Edge)->Index == Node.Index))
+						if (Lk.Node == OtherNodeIndex)
 						{
 							bConnected = true;
 							break;
@@ -172,7 +174,7 @@ public:
 
 			// Apply separation force
 			AddDelta(OtherNode->Index, Node.Index, RepulsionConstant * SeparationMagnitude * SeparationDir);
-		}
+		});
 	}
 
 protected:
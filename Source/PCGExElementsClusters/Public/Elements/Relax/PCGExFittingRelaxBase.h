@@ -8,6 +8,7 @@
 #include "PCGExRelaxClusterOperation.h"
 #include "Core/PCGExContext.h"
 #include "Data/PCGExData.h"
+#include "Math/PCGExSpatialHashGrid.h"
 
 
 #include "PCGExFittingRelaxBase.generated.h"
@@ -114,7 +115,9 @@ public:
 			return EPCGExClusterElement::Edge;
 		}
 
-		// Step 2 : Apply repulsion forces between all pairs of nodes
+		// Step 2 : Apply repulsion forces between nearby pairs of nodes
+		if (InStep == 1 && MaxReach > 0) { NeighborGrid.Build(*ReadBuffer, MaxReach * 2); }
+
 		// Step 3 : Update positions based on accumulated forces
 		return EPCGExClusterElement::Vtx;
 	}
@@ -129,8 +132,8 @@ public:
 		const int32 Start = Cluster->GetEdgeStart(Edge)->Index;
 		const int32 End = Cluster->GetEdgeEnd(Edge)->Index;
 
-		const FVector& StartPos = (ReadBuffer->GetData() + Start)->GetLocation();
-		const FVector& EndPos = (ReadBuffer->GetData() + End)->GetLocation();
+		const FVector& StartPos = *(ReadBuffer->GetData() + Start);
+		const FVector& EndPos = *(ReadBuffer->GetData() + End);
 
 		const FVector Delta = EndPos - StartPos;
 		const double CurrentLength = Delta.Size();
@@ -146,13 +149,31 @@ public:
 	virtual void Step3(const PCGExClusters::FNode& Node) override
 	{
 		// Update positions based on accumulated forces
-		const FVector Position = (ReadBuffer->GetData() + Node.Index)->GetLocation();
-		(*WriteBuffer)[Node.Index].SetLocation(Position + GetDelta(Node.Index) * TimeStep);
+		const FVector Position = *(ReadBuffer->GetData() + Node.Index);
+		(*WriteBuffer)[Node.Index] = Position + GetDelta(Node.Index) * TimeStep;
 	}
 
 protected:
 	TSharedPtr<TArray<double>> EdgeLengths;
 
+	/**
+	 * Largest distance, along any axis, between a node position and the boundary of its footprint.
+	 * Two nodes can only interact when they are within twice that distance of each other; used as the neighbor grid cell size.
+	 */
+	double MaxReach = 0;
+	PCGExMath::FSpatialHashGrid NeighborGrid;
+
+	/** Invokes Func(OtherNodeIndex) for every node with a higher index that may overlap the given one. */
+	template <typename FuncType>
+	void ForEachRepulsionCandidate(const int32 NodeIndex, FuncType&& Func) const
+	{
+		if (MaxReach <= 0) { return; }
+		NeighborGrid.ForEachInNeighborhood(*(ReadBuffer->GetData() + NodeIndex), [&](const int32 OtherNodeIndex)
+		{
+			if (OtherNodeIndex > NodeIndex) { Func(OtherNodeIndex); }
+		});
+	}
+
 	FVector GetDelta(const int32 Index) const
 	{
 		const FInt64Vector3& P = Deltas[Index];
@@ -5,8 +5,16 @@
 
 #include "CoreMinimal.h"
 #include "PCGExRelaxClusterOperation.h"
+#include "Math/PCGExBarnesHutTree.h"
 #include "PCGExForceDirectedRelax.generated.h"
 
+UENUM()
+enum class EPCGExForceDirectedRepulsion : uint8
+{
+	Neighbors = 0 UMETA(DisplayName = "Neighbors", ToolTip="Repulsion is only applied between connected nodes"),
+	Global    = 1 UMETA(DisplayName = "Global", ToolTip="Repulsion is applied between all nodes of the cluster, approximated using a Barnes-Hut octree"),
+};
+
 /**
  * 
  */
@@ -23,22 +31,40 @@ public:
 		{
 			SpringConstant = TypedOther->SpringConstant;
 			ElectrostaticConstant = TypedOther->ElectrostaticConstant;
+			Repulsion = TypedOther->Repulsion;
+			Theta = TypedOther->Theta;
 		}
 	}
 
+	virtual EPCGExClusterElement PrepareNextStep(const int32 InStep) override
+	{
+		EPCGExClusterElement Source = Super::PrepareNextStep(InStep); // Super does the buffer swap, needs to happen first
+		if (InStep == 0 && Repulsion == EPCGExForceDirectedRepulsion::Global) { RepulsionTree.Build(*ReadBuffer); }
+		return Source;
+	}
+
 	virtual void Step1(const PCGExClusters::FNode& Node) override
 	{
-		const FVector Position = (ReadBuffer->GetData() + Node.Index)->GetLocation();
+		const FVector Position = *(ReadBuffer->GetData() + Node.Index);
 		FVector Force = FVector::ZeroVector;
 
-		for (const PCGExGraphs::FLink& Lk : Node.Links)
+		for (const PCGExGraphs::FLink Lk : Cluster->GetLinks(Node.Index))
 		{
-			const FVector OtherPosition = (ReadBuffer->GetData() + Lk.Node)->GetLocation();
+			const FVector OtherPosition = *(ReadBuffer->GetData() + Lk.Node);
 			CalculateAttractiveForce(Force, Position, OtherPosition);
-			CalculateRepulsiveForce(Force, Position, OtherPosition);
+			if (Repulsion == EPCGExForceDirectedRepulsion::Neighbors) { CalculateRepulsiveForce(Force, Position, OtherPosition); }
+		}
+
+		if (Repulsion == EPCGExForceDirectedRepulsion::Global)
+		{
+			RepulsionTree.ForEachBody(
+				Position, Theta, Node.Index, [&](const FVector& OtherPosition, const double Mass)
+				{
+					CalculateRepulsiveForce(Force, Position, OtherPosition, Mass);
+				});
 		}
 
-		(*WriteBuffer)[Node.Index].SetLocation(Position + Force);
+		(*WriteBuffer)[Node.Index] = Position + Force;
 	}
 
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
@@ -47,7 +73,23 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
 	double ElectrostaticConstant = 1000;
 
+	/** Which nodes repel each other. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
+	EPCGExForceDirectedRepulsion Repulsion = EPCGExForceDirectedRepulsion::Neighbors;
+
+	/** Barnes-Hut accuracy threshold. Groups of nodes whose size to distance ratio is below this value are treated as a single body. Lower is more accurate but slower; 0 is exact. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, EditCondition="Repulsion == EPCGExForceDirectedRepulsion::Global", EditConditionHides, ClampMin=0))
+	double Theta = 0.75;
+
+	virtual void Cleanup() override
+	{
+		RepulsionTree.Reset();
+		Super::Cleanup();
+	}
+
 protected:
+	PCGExMath::FBarnesHutTree RepulsionTree;
+
 	void CalculateAttractiveForce(FVector& Force, const FVector& A, const FVector& B) const
 	{
 		// Calculate the displacement vector between the nodes
@@ -61,7 +103,7 @@ protected:
 		Force += Displacement * ForceMagnitude;
 	}
 
-	void CalculateRepulsiveForce(FVector& Force, const FVector& A, const FVector& B) const
+	void CalculateRepulsiveForce(FVector& Force, const FVector& A, const FVector& B, const double Mass = 1) const
 	{
 		// Calculate the displacement vector between the nodes
 		FVector Displacement = B - A;
@@ -70,7 +112,7 @@ protected:
 		Displacement /= Distance;
 
 		// Calculate the force magnitude using Coulomb's law
-		const double ForceMagnitude = ElectrostaticConstant / (Distance * Distance);
+		const double ForceMagnitude = Mass * ElectrostaticConstant / (Distance * Distance);
 		Force -= Displacement * ForceMagnitude;
 	}
 };
@@ -18,11 +18,11 @@ class UPCGExLaplacianRelax : public UPCGExRelaxClusterOperation
 public:
 	virtual void Step1(const PCGExClusters::FNode& Node) override
 	{
-		const FVector Position = (ReadBuffer->GetData() + Node.Index)->GetLocation();
+		const FVector Position = *(ReadBuffer->GetData() + Node.Index);
 		FVector Force = FVector::ZeroVector;
 
-		for (const PCGExGraphs::FLink& Lk : Node.Links) { Force += (ReadBuffer->GetData() + Lk.Node)->GetLocation() - Position; }
+		for (const PCGExGraphs::FLink Lk : Cluster->GetLinks(Node.Index)) { Force += *(ReadBuffer->GetData() + Lk.Node) - Position; }
 
-		(*WriteBuffer)[Node.Index].SetLocation(Position + Force / static_cast<double>(Node.Links.Num()));
+		(*WriteBuffer)[Node.Index] = Position + Force / static_cast<double>(Node.Links.Num());
 	}
 };
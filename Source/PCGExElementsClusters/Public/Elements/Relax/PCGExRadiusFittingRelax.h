@@ -54,29 +54,32 @@ public:
 		RadiusBuffer = GetValueSettingRadius();
 		if (!RadiusBuffer->Init(PrimaryDataFacade)) { return false; }
 
+		MaxReach = 0;
+		for (const PCGExClusters::FNode& Node : *Cluster->Nodes) { MaxReach = FMath::Max(MaxReach, FMath::Abs(RadiusBuffer->Read(Node.PointIndex))); }
+
 		return true;
 	}
 
 	virtual void Step2(const PCGExClusters::FNode& Node) override
 	{
-		const FVector& CurrentPos = (ReadBuffer->GetData() + Node.Index)->GetLocation();
+		const FVector& CurrentPos = *(ReadBuffer->GetData() + Node.Index);
 		const double& CurrentRadius = RadiusBuffer->Read(Node.PointIndex);
 
-		// Apply repulsion forces between all pairs of nodes
+		// Apply repulsion forces between nearby pairs of nodes
 
-		for (int32 OtherNodeIndex = Node.Index + 1; OtherNodeIndex < Cluster->Nodes->Num(); OtherNodeIndex++)
+		ForEachRepulsionCandidate(Node.Index, [&](const int32 OtherNodeIndex)
 		{
 			const PCGExClusters::FNode* OtherNode = Cluster->GetNode(OtherNodeIndex);
-			const FVector& OtherPos = (ReadBuffer->GetData() + OtherNodeIndex)->GetLocation();
+			const FVector& OtherPos = *(ReadBuffer->GetData() + OtherNodeIndex);
 
 			FVector Delta = OtherPos - CurrentPos;
 			const double Distance = Delta.Size();
 			const double Overlap = (CurrentRadius + RadiusBuffer->Read(OtherNode->PointIndex)) - Distance;
 
-			if (Overlap <= 0 || Distance <= KINDA_SMALL_NUMBER) { continue; }
+			if (Overlap <= 0 || Distance <= KINDA_SMALL_NUMBER) { return; }
 
 			AddDelta(OtherNode->Index, Node.Index, (RepulsionConstant * (Overlap / FMath::Square(Distance)) * (Delta / Distance)));
-		}
+		});
 	}
 
 protected:
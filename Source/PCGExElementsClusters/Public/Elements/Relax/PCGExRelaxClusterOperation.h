@@ -32,6 +32,7 @@ public:
 	virtual bool PrepareForCluster(FPCGExContext* InContext, const TSharedPtr<PCGExClusters::FCluster>& InCluster)
 	{
 		Cluster = InCluster;
+		Cluster->GetCSR(); // Relaxing sweeps the whole adjacency every iteration
 		return true;
 	}
 
@@ -74,8 +75,8 @@ public:
 	}
 
 	TSharedPtr<PCGExClusters::FCluster> Cluster;
-	TArray<FTransform>* ReadBuffer = nullptr;
-	TArray<FTransform>* WriteBuffer = nullptr;
+	TArray<FVector>* ReadBuffer = nullptr;
+	TArray<FVector>* WriteBuffer = nullptr;
 
 
 	virtual void Cleanup() override
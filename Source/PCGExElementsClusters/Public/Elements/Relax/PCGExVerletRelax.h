@@ -154,14 +154,14 @@ public:
 		const double F = (1 - FrictionBuffer->Read(Node.PointIndex)) * 0.99;
 
 		const FVector G = GravityBuffer->Read(Node.PointIndex);
-		const FVector P = (*ReadBuffer)[Node.Index].GetLocation();
+		const FVector P = (*ReadBuffer)[Node.Index];
 		AddDelta(Node.Index, G * (TimeStep * TimeStep)); // Add delta of force
 
 		// Write buffer is the old position at this point
-		const FVector V = (P - (*WriteBuffer)[Node.Index].GetLocation()) * F;
+		const FVector V = (P - (*WriteBuffer)[Node.Index]) * F;
 
 		// Compute predicted position, NOT accounting for deltas, only verlet velocity
-		(*WriteBuffer)[Node.Index].SetLocation(P + V);
+		(*WriteBuffer)[Node.Index] = P + V;
 	}
 
 	virtual void Step2(const PCGExGraphs::FEdge& Edge) override
@@ -173,8 +173,8 @@ public:
 		const int32 A = NodeA->Index;
 		const int32 B = NodeB->Index;
 
-		const FVector PA = (*WriteBuffer)[A].GetLocation();
-		const FVector PB = (*WriteBuffer)[B].GetLocation();
+		const FVector PA = (*WriteBuffer)[A];
+		const FVector PB = (*WriteBuffer)[B];
 
 		const double RestLength = *(EdgeLengths->GetData() + Edge.Index) * ScalingBuffer->Read(Edge.PointIndex);
 		const double L = FVector::Dist(PA, PB);
@@ -191,7 +191,7 @@ public:
 	{
 		// Update positions based on accumulated forces
 		if (FrictionBuffer->Read(Node.Index) >= 1) { return; }
-		(*WriteBuffer)[Node.Index].SetLocation((*WriteBuffer)[Node.Index].GetLocation() + GetDelta(Node.Index));
+		(*WriteBuffer)[Node.Index] += GetDelta(Node.Index);
 	}
 
 protected:
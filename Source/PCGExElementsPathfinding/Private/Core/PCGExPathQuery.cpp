@@ -130,6 +130,46 @@ namespace PCGExPathfinding
 		}
 	}
 
+	void FindSharedSeedPaths(const TArray<TSharedPtr<FPathQuery>>& InQueries, const TSharedPtr<FPCGExSearchOperation>& SearchOperation, const TSharedPtr<FSearchAllocations>& Allocations, const TSharedPtr<PCGExHeuristics::FHandler>& HeuristicsHandler)
+	{
+		TArray<TSharedPtr<FPathQuery>> ValidQueries;
+		ValidQueries.Reserve(InQueries.Num());
+
+		for (const TSharedPtr<FPathQuery>& Query : InQueries)
+		{
+			if (Query->PickResolution != EQueryPickResolution::Success) { Query->SetResolution(EPathfindingResolution::Fail); }
+			else { ValidQueries.Add(Query); }
+		}
+
+		ValidQueries.Sort([](const TSharedPtr<FPathQuery>& A, const TSharedPtr<FPathQuery>& B) { return A->Seed.Node->Index < B->Seed.Node->Index; });
+
+		TArray<TSharedPtr<FPathQuery>> SharedSeedQueries;
+		SharedSeedQueries.Reserve(ValidQueries.Num());
+
+		int32 RunStart = 0;
+		while (RunStart < ValidQueries.Num())
+		{
+			const PCGExClusters::FNode* SeedNode = ValidQueries[RunStart]->Seed.Node;
+
+			int32 RunEnd = RunStart + 1;
+			while (RunEnd < ValidQueries.Num() && ValidQueries[RunEnd]->Seed.Node == SeedNode) { RunEnd++; }
+
+			SharedSeedQueries.Reset();
+			for (int i = RunStart; i < RunEnd; i++) { SharedSeedQueries.Add(ValidQueries[i]); }
+
+			if (SharedSeedQueries.Num() > 1 && SearchOperation->ResolveSharedSeedQueries(SharedSeedQueries, Allocations, HeuristicsHandler))
+			{
+				for (const TSharedPtr<FPathQuery>& Query : SharedSeedQueries) { Query->SetResolution(Query->HasValidPathPoints() ? EPathfindingResolution::Success : EPathfindingResolution::Fail); }
+			}
+			else
+			{
+				for (const TSharedPtr<FPathQuery>& Query : SharedSeedQueries) { Query->FindPath(SearchOperation, Allocations, HeuristicsHandler, nullptr); }
+			}
+
+			RunStart = RunEnd;
+		}
+	}
+
 	void FPathQuery::AppendNodePoints(TArray<int32>& OutPoints, const int32 TruncateStart, const int32 TruncateEnd) const
 	{
 		const int32 Count = PathNodes.Num() - TruncateEnd;
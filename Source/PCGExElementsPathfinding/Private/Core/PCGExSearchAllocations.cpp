@@ -6,35 +6,70 @@
 #include "PCGExH.h"
 #include "Clusters/PCGExCluster.h"
 #include "Containers/PCGExHashLookup.h"
+#include "Search/PCGExSearchOperation.h"
+#include "Utils/PCGExRadixQueue.h"
 #include "Utils/PCGExScoredQueue.h"
 
 namespace PCGExPathfinding
 {
+	const TSharedPtr<PCGEx::FRadixQueue>& FSearchAllocations::GetRadixQueue()
+	{
+		if (!RadixQueue) { RadixQueue = MakeShared<PCGEx::FRadixQueue>(Capacity); }
+		return RadixQueue;
+	}
+
 	void FSearchAllocations::Reset()
 	{
-		if (GScore.Num() == Visited.Num())
+		Visited.Reset();
+		GScore.Reset();
+		TravelStack->Reset();
+		ScoredQueue->Reset();
+		if (RadixQueue) { RadixQueue->Reset(); }
+	}
+
+	void FSearchAllocations::Init(const PCGExClusters::FCluster* InCluster)
+	{
+		NumNodes = InCluster->Nodes->Num();
+
+		if (NumNodes > Capacity || !TravelStack)
 		{
-			for (int i = 0; i < NumNodes; i++)
-			{
-				Visited[i] = false;
-				GScore[i] = -1;
-			}
+			Capacity = NumNodes;
+			Allocate();
 		}
 		else
 		{
-			for (int i = 0; i < NumNodes; i++) { Visited[i] = false; }
+			Reset();
 		}
+	}
 
-		TravelStack->Reset();
-		ScoredQueue->Reset();
+	void FSearchAllocations::Allocate()
+	{
+		Visited.Init(false, Capacity);
+		GScore.Init(-1, Capacity);
+		TravelStack = PCGEx::NewHashLookup<PCGEx::FHashLookupStamped>(PCGEx::NH64(-1, -1), Capacity);
+		ScoredQueue = MakeShared<PCGEx::FScoredQueue>(Capacity);
+		RadixQueue.Reset();
 	}
 
-	void FSearchAllocations::Init(const PCGExClusters::FCluster* InCluster)
+	TSharedPtr<FSearchAllocations> FSearchAllocationsPool::Acquire(const FPCGExSearchOperation* InOperation)
 	{
-		NumNodes = InCluster->Nodes->Num();
+		TSharedPtr<FSearchAllocations> Allocations;
+
+		{
+			FWriteScopeLock WriteScopeLock(PoolLock);
+			if (!Available.IsEmpty()) { Allocations = Available.Pop(EAllowShrinking::No); }
+		}
+
+		if (!Allocations) { return InOperation->NewAllocations(); }
 
-		Visited.Init(false, NumNodes);
-		TravelStack = PCGEx::NewHashLookup<PCGEx::FHashLookupArray>(PCGEx::NH64(-1, -1), NumNodes);
-		ScoredQueue = MakeShared<PCGEx::FScoredQueue>(NumNodes);
+		Allocations->Init(InOperation->Cluster);
+		return Allocations;
+	}
+
+	void FSearchAllocationsPool::Release(const TSharedPtr<FSearchAllocations>& InAllocations)
+	{
+		if (!InAllocations) { return; }
+		FWriteScopeLock WriteScopeLock(PoolLock);
+		Available.Add(InAllocations);
 	}
 }
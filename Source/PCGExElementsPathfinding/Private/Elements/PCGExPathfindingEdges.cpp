@@ -13,6 +13,7 @@
 #include "Clusters/PCGExClustersHelpers.h"
 #include "Core/PCGExHeuristicsFactoryProvider.h"
 #include "Core/PCGExPathQuery.h"
+#include "Core/PCGExSearchAllocations.h"
 #include "Data/Utils/PCGExDataForward.h"
 #include "GoalPickers/PCGExGoalPickerRandom.h"
 #include "Search/PCGExSearchAStar.h"
@@ -141,6 +142,7 @@ bool FPCGExPathfindingEdgesElement::Boot(FPCGExContext* InContext) const
 
 	PCGEX_OPERATION_BIND(GoalPicker, UPCGExGoalPicker, PCGExPathfinding::Labels::SourceOverridesGoalPicker)
 	PCGEX_OPERATION_BIND(SearchAlgorithm, UPCGExSearchInstancedFactory, PCGExPathfinding::Labels::SourceOverridesSearch)
+	Context->SearchAllocationsPool = MakeShared<PCGExPathfinding::FSearchAllocationsPool>();
 
 	Context->SeedsDataFacade = PCGExData::TryGetSingleFacade(Context, PCGExCommon::Labels::SourceSeedsLabel, false, true);
 	if (!Context->SeedsDataFacade) { return false; }
@@ -263,12 +265,64 @@ namespace PCGExPathfindingEdges
 			QueriesIO[i]->Disable();
 		}
 
+		bShareSearchTrees = Settings->bShareSearchTrees && !HeuristicsHandler->HasAnyFeedback();
+		if (bShareSearchTrees)
+		{
+			TMap<int32, int32> SeedGroupMap;
+			for (int i = 0; i < NumQueries; i++)
+			{
+				const int32 SeedIndex = PCGEx::H64A(Context->SeedGoalPairs[i]);
+				if (const int32* GroupIndex = SeedGroupMap.Find(SeedIndex)) { SeedGroups[*GroupIndex].Add(i); }
+				else
+				{
+					SeedGroupMap.Add(SeedIndex, SeedGroups.Num());
+					SeedGroups.Emplace_GetRef().Add(i);
+				}
+			}
+
+			StartParallelLoopForRange(SeedGroups.Num(), bForceSingleThreadedProcessRange ? 12 : 1);
+			return true;
+		}
+
 		StartParallelLoopForRange(Queries.Num(), bForceSingleThreadedProcessRange ? 12 : 1);
 		return true;
 	}
 
 	void FProcessor::ProcessRange(const PCGExMT::FScope& Scope)
 	{
+		// Greedy queries borrow pooled allocations for the duration of the scope
+		TSharedPtr<PCGExPathfinding::FSearchAllocations> LocalAllocations = SearchAllocations;
+		if (!LocalAllocations) { LocalAllocations = Context->SearchAllocationsPool->Acquire(SearchOperation.Get()); }
+
+		ON_SCOPE_EXIT { if (!SearchAllocations) { Context->SearchAllocationsPool->Release(LocalAllocations); } };
+
+		if (bShareSearchTrees)
+		{
+			TArray<TSharedPtr<PCGExPathfinding::FPathQuery>> GroupQueries;
+
+			PCGEX_SCOPE_LOOP(GroupIndex)
+			{
+				GroupQueries.Reset();
+				for (const int32 Index : SeedGroups[GroupIndex])
+				{
+					const TSharedPtr<PCGExPathfinding::FPathQuery>& Query = Queries[Index];
+					Query->ResolvePicks(Settings->SeedPicking, Settings->GoalPicking);
+					if (Query->HasValidEndpoints()) { GroupQueries.Add(Query); }
+				}
+
+				PCGExPathfinding::FindSharedSeedPaths(GroupQueries, SearchOperation, LocalAllocations, HeuristicsHandler);
+
+				for (const int32 Index : SeedGroups[GroupIndex])
+				{
+					const TSharedPtr<PCGExPathfinding::FPathQuery>& Query = Queries[Index];
+					if (Query->IsQuerySuccessful()) { Context->BuildPath(Query, QueriesIO[Query->QueryIndex]); }
+					Query->Cleanup();
+				}
+			}
+
+			return;
+		}
+
 		PCGEX_SCOPE_LOOP(Index)
 		{
 			TSharedPtr<PCGExPathfinding::FPathQuery> Query = Queries[Index];
@@ -279,7 +333,7 @@ namespace PCGExPathfindingEdges
 
 			if (!Query->HasValidEndpoints()) { continue; }
 
-			Query->FindPath(SearchOperation, SearchAllocations, HeuristicsHandler, nullptr);
+			Query->FindPath(SearchOperation, LocalAllocations, HeuristicsHandler, nullptr);
 
 			if (!Query->IsQuerySuccessful()) { continue; }
 
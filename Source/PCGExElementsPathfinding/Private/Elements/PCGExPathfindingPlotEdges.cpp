@@ -15,6 +15,7 @@
 #include "Core/PCGExHeuristicsFactoryProvider.h"
 #include "Core/PCGExPathQuery.h"
 #include "Core/PCGExPlotQuery.h"
+#include "Core/PCGExSearchAllocations.h"
 #include "Search/PCGExSearchAStar.h"
 #include "Helpers/PCGExDataMatcher.h"
 #include "Helpers/PCGExMatchingHelpers.h"
@@ -199,6 +200,7 @@ bool FPCGExPathfindingPlotEdgesElement::Boot(FPCGExContext* InContext) const
 	Context->EdgesDataForwarding.bEnabled = Settings->EdgesDataForwarding.bEnabled && Settings->PathComposition == EPCGExPathComposition::Vtx;
 
 	PCGEX_OPERATION_BIND(SearchAlgorithm, UPCGExSearchInstancedFactory, PCGExPathfinding::Labels::SourceOverridesSearch)
+	Context->SearchAllocationsPool = MakeShared<PCGExPathfinding::FSearchAllocationsPool>();
 
 	Context->OutputPaths = MakeShared<PCGExData::FPointIOCollection>(Context);
 	Context->OutputPaths->OutputPin = PCGExPaths::Labels::OutputPathsLabel;
@@ -372,7 +374,7 @@ namespace PCGExPathfindingPlotEdges
 				This->Context->BuildPath(Plot, This->QueriesIO[Plot->QueryIndex]);
 				Plot->Cleanup();
 			};
-			Query->FindPaths(TaskManager, SearchOperation, SearchAllocations, HeuristicsHandler);
+			Query->FindPaths(TaskManager, SearchOperation, SearchAllocations, HeuristicsHandler, Context->SearchAllocationsPool);
 		}
 	}
 
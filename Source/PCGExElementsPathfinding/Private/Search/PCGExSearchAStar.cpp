@@ -10,6 +10,7 @@
 #include "Core/PCGExPathfinding.h"
 #include "Core/PCGExPathQuery.h"
 #include "Core/PCGExSearchAllocations.h"
+#include "Utils/PCGExRadixQueue.h"
 #include "Utils/PCGExScoredQueue.h"
 
 bool FPCGExSearchOperationAStar::ResolveQuery(
@@ -24,44 +25,53 @@ bool FPCGExSearchOperationAStar::ResolveQuery(
 	if (!LocalAllocations) { LocalAllocations = NewAllocations(); }
 	else { LocalAllocations->Reset(); }
 
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPCGExSearchAStar::FindPath);
+
+	if (bUseRadixQueue) { return Search(InQuery, LocalAllocations.Get(), *LocalAllocations->GetRadixQueue(), Heuristics, LocalFeedback.Get()); }
+	return Search(InQuery, LocalAllocations.Get(), *LocalAllocations->ScoredQueue, Heuristics, LocalFeedback.Get());
+}
+
+template <typename QueueT>
+bool FPCGExSearchOperationAStar::Search(
+	const TSharedPtr<PCGExPathfinding::FPathQuery>& InQuery,
+	PCGExPathfinding::FSearchAllocations* Allocations,
+	QueueT& ScoredQueue,
+	const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics,
+	const PCGExHeuristics::FLocalFeedbackHandler* Feedback) const
+{
 	const TArray<PCGExClusters::FNode>& NodesRef = *Cluster->Nodes;
 	const TArray<PCGExGraphs::FEdge>& EdgesRef = *Cluster->Edges;
 
 	const PCGExClusters::FNode& SeedNode = *InQuery->Seed.Node;
 	const PCGExClusters::FNode& GoalNode = *InQuery->Goal.Node;
 
-	TRACE_CPUPROFILER_EVENT_SCOPE(UPCGExSearchAStar::FindPath);
-
-	TBitArray<>& Visited = LocalAllocations->Visited;
-	TArray<double>& GScore = LocalAllocations->GScore;
-	const TSharedPtr<PCGEx::FHashLookup> TravelStack = LocalAllocations->TravelStack;
-	const TSharedPtr<PCGEx::FScoredQueue> ScoredQueue = LocalAllocations->ScoredQueue;
-	ScoredQueue->Enqueue(SeedNode.Index, Heuristics->GetGlobalScore(SeedNode, SeedNode, GoalNode));
+	PCGEx::TStampedArray<bool>& Visited = Allocations->Visited;
+	PCGEx::TStampedArray<double>& GScore = Allocations->GScore;
+	const TSharedPtr<PCGEx::FHashLookup> TravelStack = Allocations->TravelStack;
+	ScoredQueue.Enqueue(SeedNode.Index, Heuristics->GetGlobalScore(SeedNode, SeedNode, GoalNode));
 
-	GScore[SeedNode.Index] = 0;
-
-	const PCGExHeuristics::FLocalFeedbackHandler* Feedback = LocalFeedback.Get();
+	GScore.Set(SeedNode.Index, 0);
 
 	int32 VisitedNum = 0;
 	int32 CurrentNodeIndex;
 	double CurrentFScore;
-	while (ScoredQueue->Dequeue(CurrentNodeIndex, CurrentFScore))
+	while (ScoredQueue.Dequeue(CurrentNodeIndex, CurrentFScore))
 	{
 		if (bEarlyExit && CurrentNodeIndex == GoalNode.Index) { break; } // Exit early
 
-		const double CurrentGScore = GScore[CurrentNodeIndex];
+		const double CurrentGScore = GScore.Get(CurrentNodeIndex);
 		const PCGExClusters::FNode& Current = NodesRef[CurrentNodeIndex];
 
-		if (Visited[CurrentNodeIndex]) { continue; }
-		Visited[CurrentNodeIndex] = true;
+		if (Visited.IsSet(CurrentNodeIndex)) { continue; }
+		Visited.Set(CurrentNodeIndex, true);
 		VisitedNum++;
 
-		for (const PCGExGraphs::FLink Lk : Current.Links)
+		for (const PCGExGraphs::FLink Lk : Cluster->GetLinks(CurrentNodeIndex))
 		{
 			const uint32 NeighborIndex = Lk.Node;
 			const uint32 EdgeIndex = Lk.Edge;
 
-			if (Visited[NeighborIndex]) { continue; }
+			if (Visited.IsSet(NeighborIndex)) { continue; }
 
 			const PCGExClusters::FNode& AdjacentNode = NodesRef[NeighborIndex];
 			const PCGExGraphs::FEdge& Edge = EdgesRef[EdgeIndex];
@@ -69,16 +79,16 @@ bool FPCGExSearchOperationAStar::ResolveQuery(
 			const double EScore = Heuristics->GetEdgeScore(Current, AdjacentNode, Edge, SeedNode, GoalNode, Feedback, TravelStack);
 			const double TentativeGScore = CurrentGScore + EScore;
 
-			const double PreviousGScore = GScore[NeighborIndex];
+			const double PreviousGScore = GScore.Get(NeighborIndex);
 			if (PreviousGScore != -1 && TentativeGScore >= PreviousGScore) { continue; }
 
 			TravelStack->Set(NeighborIndex, PCGEx::NH64(CurrentNodeIndex, EdgeIndex));
-			GScore[NeighborIndex] = TentativeGScore;
+			GScore.Set(NeighborIndex, TentativeGScore);
 
 			const double GS = Heuristics->GetGlobalScore(AdjacentNode, SeedNode, GoalNode, Feedback);
 			const double FScore = TentativeGScore + GS * Heuristics->ReferenceWeight;
 
-			ScoredQueue->Enqueue(NeighborIndex, FScore);
+			ScoredQueue.Enqueue(NeighborIndex, FScore);
 		}
 	}
 
@@ -106,9 +116,11 @@ bool FPCGExSearchOperationAStar::ResolveQuery(
 	return bSuccess;
 }
 
-TSharedPtr<PCGExPathfinding::FSearchAllocations> FPCGExSearchOperationAStar::NewAllocations() const
+void UPCGExSearchAStar::CopySettingsFrom(const UPCGExInstancedFactory* Other)
 {
-	TSharedPtr<PCGExPathfinding::FSearchAllocations> Allocations = FPCGExSearchOperation::NewAllocations();
-	Allocations->GScore.Init(-1, Cluster->Nodes->Num());
-	return Allocations;
+	Super::CopySettingsFrom(Other);
+	if (const UPCGExSearchAStar* TypedOther = Cast<UPCGExSearchAStar>(Other))
+	{
+		bUseRadixQueue = TypedOther->bUseRadixQueue;
+	}
 }
@@ -32,13 +32,13 @@ bool FPCGExSearchOperationBellmanFord::ResolveQuery(
 
 	TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExSearchOperationBellmanFord::FindPath);
 
-	TArray<double>& Distance = LocalAllocations->GScore;
+	PCGEx::TStampedArray<double>& Distance = LocalAllocations->GScore; // Unset entries are unreachable
 	const TSharedPtr<PCGEx::FHashLookup> TravelStack = LocalAllocations->TravelStack;
 
 	const PCGExHeuristics::FLocalFeedbackHandler* Feedback = LocalFeedback.Get();
 
 	// Initialize distances
-	Distance[SeedNode.Index] = 0;
+	Distance.Set(SeedNode.Index, 0);
 
 	// Relax all edges |V| - 1 times
 	for (int32 Iteration = 0; Iteration < NumNodes - 1; Iteration++)
@@ -48,12 +48,12 @@ bool FPCGExSearchOperationBellmanFord::ResolveQuery(
 		// For each node, check all outgoing edges
 		for (int32 NodeIndex = 0; NodeIndex < NumNodes; NodeIndex++)
 		{
-			const double CurrentDist = Distance[NodeIndex];
-			if (CurrentDist == MAX_dbl) { continue; } // Not yet reachable
+			if (!Distance.IsSet(NodeIndex)) { continue; } // Not yet reachable
+			const double CurrentDist = Distance.Get(NodeIndex);
 
 			const PCGExClusters::FNode& CurrentNode = NodesRef[NodeIndex];
 
-			for (const PCGExGraphs::FLink Lk : CurrentNode.Links)
+			for (const PCGExGraphs::FLink Lk : Cluster->GetLinks(NodeIndex))
 			{
 				const uint32 NeighborIndex = Lk.Node;
 				const uint32 EdgeIndex = Lk.Edge;
@@ -64,9 +64,9 @@ bool FPCGExSearchOperationBellmanFord::ResolveQuery(
 				const double EdgeWeight = Heuristics->GetEdgeScore(CurrentNode, AdjacentNode, Edge, SeedNode, GoalNode, Feedback, TravelStack);
 				const double NewDist = CurrentDist + EdgeWeight;
 
-				if (NewDist < Distance[NeighborIndex])
+				if (!Distance.IsSet(NeighborIndex) || NewDist < Distance.Get(NeighborIndex))
 				{
-					Distance[NeighborIndex] = NewDist;
+					Distance.Set(NeighborIndex, NewDist);
 					TravelStack->Set(NeighborIndex, PCGEx::NH64(NodeIndex, EdgeIndex));
 					bAnyRelaxation = true;
 				}
@@ -77,7 +77,7 @@ bool FPCGExSearchOperationBellmanFord::ResolveQuery(
 		if (!bAnyRelaxation) { break; }
 
 		// Early exit if goal is reachable and we want to exit early
-		if (bEarlyExit && Distance[GoalNode.Index] != MAX_dbl && !bAnyRelaxation) { break; }
+		if (bEarlyExit && Distance.IsSet(GoalNode.Index) && !bAnyRelaxation) { break; }
 	}
 
 	// Check for negative weight cycles if requested
@@ -85,12 +85,12 @@ bool FPCGExSearchOperationBellmanFord::ResolveQuery(
 	{
 		for (int32 NodeIndex = 0; NodeIndex < NumNodes; NodeIndex++)
 		{
-			const double CurrentDist = Distance[NodeIndex];
-			if (CurrentDist == MAX_dbl) { continue; }
+			if (!Distance.IsSet(NodeIndex)) { continue; }
+			const double CurrentDist = Distance.Get(NodeIndex);
 
 			const PCGExClusters::FNode& CurrentNode = NodesRef[NodeIndex];
 
-			for (const PCGExGraphs::FLink Lk : CurrentNode.Links)
+			for (const PCGExGraphs::FLink Lk : Cluster->GetLinks(NodeIndex))
 			{
 				const uint32 NeighborIndex = Lk.Node;
 				const uint32 EdgeIndex = Lk.Edge;
@@ -101,7 +101,7 @@ bool FPCGExSearchOperationBellmanFord::ResolveQuery(
 				const double EdgeWeight = Heuristics->GetEdgeScore(CurrentNode, AdjacentNode, Edge, SeedNode, GoalNode, Feedback, TravelStack);
 
 				// If we can still relax, there's a negative cycle
-				if (CurrentDist + EdgeWeight < Distance[NeighborIndex])
+				if (!Distance.IsSet(NeighborIndex) || CurrentDist + EdgeWeight < Distance.Get(NeighborIndex))
 				{
 					// Negative cycle detected - path finding fails
 					return false;
@@ -111,7 +111,7 @@ bool FPCGExSearchOperationBellmanFord::ResolveQuery(
 	}
 
 	// Check if goal is reachable
-	if (Distance[GoalNode.Index] == MAX_dbl) { return false; }
+	if (!Distance.IsSet(GoalNode.Index)) { return false; }
 
 	// Reconstruct path
 	int32 PathNodeIndex = PCGEx::NH64A(TravelStack->Get(GoalNode.Index));
@@ -134,13 +134,6 @@ bool FPCGExSearchOperationBellmanFord::ResolveQuery(
 	return false;
 }
 
-TSharedPtr<PCGExPathfinding::FSearchAllocations> FPCGExSearchOperationBellmanFord::NewAllocations() const
-{
-	TSharedPtr<PCGExPathfinding::FSearchAllocations> NewAllocations = FPCGExSearchOperation::NewAllocations();
-	NewAllocations->GScore.Init(MAX_dbl, Cluster->Nodes->Num()); // Use MAX_dbl as infinity
-	return NewAllocations;
-}
-
 void UPCGExSearchBellmanFord::CopySettingsFrom(const UPCGExInstancedFactory* Other)
 {
 	Super::CopySettingsFrom(Other);
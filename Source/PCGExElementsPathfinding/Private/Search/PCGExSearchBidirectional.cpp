@@ -13,30 +13,22 @@
 
 namespace PCGExPathfinding
 {
-	void FBidirectionalSearchAllocations::Init(const PCGExClusters::FCluster* InCluster)
+	void FBidirectionalSearchAllocations::Allocate()
 	{
-		FSearchAllocations::Init(InCluster);
+		FSearchAllocations::Allocate();
 
-		GScore.Init(-1, NumNodes);
-		VisitedBackward.Init(false, NumNodes);
-		GScoreBackward.Init(-1, NumNodes);
-		TravelStackBackward = PCGEx::NewHashLookup<PCGEx::FHashLookupArray>(PCGEx::NH64(-1, -1), NumNodes);
-		ScoredQueueBackward = MakeShared<PCGEx::FScoredQueue>(NumNodes);
+		VisitedBackward.Init(false, Capacity);
+		GScoreBackward.Init(-1, Capacity);
+		TravelStackBackward = PCGEx::NewHashLookup<PCGEx::FHashLookupStamped>(PCGEx::NH64(-1, -1), Capacity);
+		ScoredQueueBackward = MakeShared<PCGEx::FScoredQueue>(Capacity);
 	}
 
 	void FBidirectionalSearchAllocations::Reset()
 	{
 		FSearchAllocations::Reset();
 
-		for (int i = 0; i < NumNodes; i++) { GScore[i] = -1; }
-
-		const int32 NumVisitedNodes = Visited.Num();
-		for (int i = 0; i < NumVisitedNodes; i++)
-		{
-			VisitedBackward[i] = false;
-			GScoreBackward[i] = -1;
-		}
-
+		VisitedBackward.Reset();
+		GScoreBackward.Reset();
 		TravelStackBackward->Reset();
 		ScoredQueueBackward->Reset();
 	}
@@ -70,24 +62,24 @@ bool FPCGExSearchOperationBidirectional::ResolveQuery(
 	TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExSearchOperationBidirectional::FindPath);
 
 	// Forward search structures
-	TBitArray<>& VisitedForward = LocalAllocations->Visited;
-	TArray<double>& GScoreForward = LocalAllocations->GScore;
+	PCGEx::TStampedArray<bool>& VisitedForward = LocalAllocations->Visited;
+	PCGEx::TStampedArray<double>& GScoreForward = LocalAllocations->GScore;
 	const TSharedPtr<PCGEx::FHashLookup> TravelStackForward = LocalAllocations->TravelStack;
 	const TSharedPtr<PCGEx::FScoredQueue> QueueForward = LocalAllocations->ScoredQueue;
 
 	// Backward search structures
-	TBitArray<>& VisitedBackward = LocalAllocations->VisitedBackward;
-	TArray<double>& GScoreBackward = LocalAllocations->GScoreBackward;
+	PCGEx::TStampedArray<bool>& VisitedBackward = LocalAllocations->VisitedBackward;
+	PCGEx::TStampedArray<double>& GScoreBackward = LocalAllocations->GScoreBackward;
 	const TSharedPtr<PCGEx::FHashLookup> TravelStackBackward = LocalAllocations->TravelStackBackward;
 	const TSharedPtr<PCGEx::FScoredQueue> QueueBackward = LocalAllocations->ScoredQueueBackward;
 
 	// Initialize forward search from seed
 	QueueForward->Enqueue(SeedNode.Index, 0);
-	GScoreForward[SeedNode.Index] = 0;
+	GScoreForward.Set(SeedNode.Index, 0);
 
 	// Initialize backward search from goal
 	QueueBackward->Enqueue(GoalNode.Index, 0);
-	GScoreBackward[GoalNode.Index] = 0;
+	GScoreBackward.Set(GoalNode.Index, 0);
 
 	const PCGExHeuristics::FLocalFeedbackHandler* Feedback = LocalFeedback.Get();
 
@@ -108,9 +100,9 @@ bool FPCGExSearchOperationBidirectional::ResolveQuery(
 			if (CurrentScore >= BestPathCost) { continue; }
 
 			// Check if backward search has reached this node
-			if (VisitedBackward[CurrentNodeIndex])
+			if (VisitedBackward.IsSet(CurrentNodeIndex))
 			{
-				const double PathCost = GScoreForward[CurrentNodeIndex] + GScoreBackward[CurrentNodeIndex];
+				const double PathCost = GScoreForward.Get(CurrentNodeIndex) + GScoreBackward.Get(CurrentNodeIndex);
 				if (PathCost < BestPathCost)
 				{
 					BestPathCost = PathCost;
@@ -118,18 +110,18 @@ bool FPCGExSearchOperationBidirectional::ResolveQuery(
 				}
 			}
 
-			if (!VisitedForward[CurrentNodeIndex])
+			if (!VisitedForward.IsSet(CurrentNodeIndex))
 			{
-				VisitedForward[CurrentNodeIndex] = true;
+				VisitedForward.Set(CurrentNodeIndex, true);
 				const PCGExClusters::FNode& Current = NodesRef[CurrentNodeIndex];
-				const double CurrentGScore = GScoreForward[CurrentNodeIndex];
+				const double CurrentGScore = GScoreForward.Get(CurrentNodeIndex);
 
-				for (const PCGExGraphs::FLink Lk : Current.Links)
+				for (const PCGExGraphs::FLink Lk : Cluster->GetLinks(CurrentNodeIndex))
 				{
 					const uint32 NeighborIndex = Lk.Node;
 					const uint32 EdgeIndex = Lk.Edge;
 
-					if (VisitedForward[NeighborIndex]) { continue; }
+					if (VisitedForward.IsSet(NeighborIndex)) { continue; }
 
 					const PCGExClusters::FNode& AdjacentNode = NodesRef[NeighborIndex];
 					const PCGExGraphs::FEdge& Edge = EdgesRef[EdgeIndex];
@@ -137,11 +129,11 @@ bool FPCGExSearchOperationBidirectional::ResolveQuery(
 					const double EScore = Heuristics->GetEdgeScore(Current, AdjacentNode, Edge, SeedNode, GoalNode, Feedback, TravelStackForward);
 					const double TentativeGScore = CurrentGScore + EScore;
 
-					const double PreviousGScore = GScoreForward[NeighborIndex];
+					const double PreviousGScore = GScoreForward.Get(NeighborIndex);
 					if (PreviousGScore != -1 && TentativeGScore >= PreviousGScore) { continue; }
 
 					TravelStackForward->Set(NeighborIndex, PCGEx::NH64(CurrentNodeIndex, EdgeIndex));
-					GScoreForward[NeighborIndex] = TentativeGScore;
+					GScoreForward.Set(NeighborIndex, TentativeGScore);
 
 					QueueForward->Enqueue(NeighborIndex, TentativeGScore);
 				}
@@ -158,9 +150,9 @@ bool FPCGExSearchOperationBidirectional::ResolveQuery(
 			if (CurrentScore >= BestPathCost) { continue; }
 
 			// Check if forward search has reached this node
-			if (VisitedForward[CurrentNodeIndex])
+			if (VisitedForward.IsSet(CurrentNodeIndex))
 			{
-				const double PathCost = GScoreForward[CurrentNodeIndex] + GScoreBackward[CurrentNodeIndex];
+				const double PathCost = GScoreForward.Get(CurrentNodeIndex) + GScoreBackward.Get(CurrentNodeIndex);
 				if (PathCost < BestPathCost)
 				{
 					BestPathCost = PathCost;
@@ -168,18 +160,18 @@ bool FPCGExSearchOperationBidirectional::ResolveQuery(
 				}
 			}
 
-			if (!VisitedBackward[CurrentNodeIndex])
+			if (!VisitedBackward.IsSet(CurrentNodeIndex))
 			{
-				VisitedBackward[CurrentNodeIndex] = true;
+				VisitedBackward.Set(CurrentNodeIndex, true);
 				const PCGExClusters::FNode& Current = NodesRef[CurrentNodeIndex];
-				const double CurrentGScore = GScoreBackward[CurrentNodeIndex];
+				const double CurrentGScore = GScoreBackward.Get(CurrentNodeIndex);
 
-				for (const PCGExGraphs::FLink Lk : Current.Links)
+				for (const PCGExGraphs::FLink Lk : Cluster->GetLinks(CurrentNodeIndex))
 				{
 					const uint32 NeighborIndex = Lk.Node;
 					const uint32 EdgeIndex = Lk.Edge;
 
-					if (VisitedBackward[NeighborIndex]) { continue; }
+					if (VisitedBackward.IsSet(NeighborIndex)) { continue; }
 
 					const PCGExClusters::FNode& AdjacentNode = NodesRef[NeighborIndex];
 					const PCGExGraphs::FEdge& Edge = EdgesRef[EdgeIndex];
@@ -188,11 +180,11 @@ bool FPCGExSearchOperationBidirectional::ResolveQuery(
 					const double EScore = Heuristics->GetEdgeScore(Current, AdjacentNode, Edge, GoalNode, SeedNode, Feedback, TravelStackBackward);
 					const double TentativeGScore = CurrentGScore + EScore;
 
-					const double PreviousGScore = GScoreBackward[NeighborIndex];
+					const double PreviousGScore = GScoreBackward.Get(NeighborIndex);
 					if (PreviousGScore != -1 && TentativeGScore >= PreviousGScore) { continue; }
 
 					TravelStackBackward->Set(NeighborIndex, PCGEx::NH64(CurrentNodeIndex, EdgeIndex));
-					GScoreBackward[NeighborIndex] = TentativeGScore;
+					GScoreBackward.Set(NeighborIndex, TentativeGScore);
 
 					QueueBackward->Enqueue(NeighborIndex, TentativeGScore);
 				}
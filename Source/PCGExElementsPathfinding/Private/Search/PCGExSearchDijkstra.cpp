@@ -11,6 +11,7 @@
 #include "Core/PCGExPathfinding.h"
 #include "Core/PCGExPathQuery.h"
 #include "Core/PCGExSearchAllocations.h"
+#include "Utils/PCGExRadixQueue.h"
 #include "Utils/PCGExScoredQueue.h"
 
 bool FPCGExSearchOperationDijkstra::ResolveQuery(
@@ -23,54 +24,58 @@ bool FPCGExSearchOperationDijkstra::ResolveQuery(
 	if (!LocalAllocations) { LocalAllocations = NewAllocations(); }
 	else { LocalAllocations->Reset(); }
 
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPCGExSearchDijkstra::FindPath);
+
+	if (bUseRadixQueue) { return Search(InQuery, LocalAllocations.Get(), *LocalAllocations->GetRadixQueue(), Heuristics, LocalFeedback.Get()); }
+	return Search(InQuery, LocalAllocations.Get(), *LocalAllocations->ScoredQueue, Heuristics, LocalFeedback.Get());
+}
+
+template <typename QueueT>
+bool FPCGExSearchOperationDijkstra::Search(
+	const TSharedPtr<PCGExPathfinding::FPathQuery>& InQuery,
+	PCGExPathfinding::FSearchAllocations* Allocations,
+	QueueT& ScoredQueue,
+	const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics,
+	const PCGExHeuristics::FLocalFeedbackHandler* Feedback) const
+{
 	const TArray<PCGExClusters::FNode>& NodesRef = *Cluster->Nodes;
 	const TArray<PCGExGraphs::FEdge>& EdgesRef = *Cluster->Edges;
 
 	const PCGExClusters::FNode& SeedNode = *InQuery->Seed.Node;
 	const PCGExClusters::FNode& GoalNode = *InQuery->Goal.Node;
 
-	const int32 NumNodes = NodesRef.Num();
-
-	TRACE_CPUPROFILER_EVENT_SCOPE(UPCGExSearchDijkstra::FindPath);
-
 	// Basic Dijkstra implementation
 
-	TBitArray<> Visited;
-	Visited.Init(false, NumNodes);
-
-	// TODO : Use local allocations for the hash lookup
-	const TSharedPtr<PCGEx::FHashLookup> TravelStack = PCGEx::NewHashLookup<PCGEx::FHashLookupArray>(PCGEx::NH64(-1, -1), NumNodes);
-
-	const TUniquePtr<PCGEx::FScoredQueue> ScoredQueue = MakeUnique<PCGEx::FScoredQueue>(NumNodes);
-	ScoredQueue->Enqueue(SeedNode.Index, 0);
+	PCGEx::TStampedArray<bool>& Visited = Allocations->Visited;
+	const TSharedPtr<PCGEx::FHashLookup> TravelStack = Allocations->TravelStack;
 
-	const PCGExHeuristics::FLocalFeedbackHandler* Feedback = LocalFeedback.Get();
+	ScoredQueue.Enqueue(SeedNode.Index, 0);
 
 	int32 VisitedNum = 0;
 	int32 CurrentNodeIndex;
 	double CurrentScore;
-	while (ScoredQueue->Dequeue(CurrentNodeIndex, CurrentScore))
+	while (ScoredQueue.Dequeue(CurrentNodeIndex, CurrentScore))
 	{
 		if (bEarlyExit && CurrentNodeIndex == GoalNode.Index) { break; } // Exit early
 
 		const PCGExClusters::FNode& Current = NodesRef[CurrentNodeIndex];
 
-		if (Visited[CurrentNodeIndex]) { continue; }
-		Visited[CurrentNodeIndex] = true;
+		if (Visited.IsSet(CurrentNodeIndex)) { continue; }
+		Visited.Set(CurrentNodeIndex, true);
 		VisitedNum++;
 
-		for (const PCGExGraphs::FLink Lk : Current.Links)
+		for (const PCGExGraphs::FLink Lk : Cluster->GetLinks(CurrentNodeIndex))
 		{
 			const uint32 NeighborIndex = Lk.Node;
 			const uint32 EdgeIndex = Lk.Edge;
 
-			if (Visited[NeighborIndex]) { continue; }
+			if (Visited.IsSet(NeighborIndex)) { continue; }
 
 			const PCGExClusters::FNode& AdjacentNode = NodesRef[NeighborIndex];
 			const PCGExGraphs::FEdge& Edge = EdgesRef[EdgeIndex];
 
 			const double AltScore = CurrentScore + Heuristics->GetEdgeScore(Current, AdjacentNode, Edge, SeedNode, GoalNode, Feedback, TravelStack);
-			if (ScoredQueue->Enqueue(NeighborIndex, AltScore))
+			if (ScoredQueue.Enqueue(NeighborIndex, AltScore))
 			{
 				TravelStack->Set(NeighborIndex, PCGEx::NH64(CurrentNodeIndex, EdgeIndex));
 			}
@@ -100,3 +105,105 @@ bool FPCGExSearchOperationDijkstra::ResolveQuery(
 
 	return bSuccess;
 }
+
+bool FPCGExSearchOperationDijkstra::ResolveSharedSeedQueries(
+	const TArray<TSharedPtr<PCGExPathfinding::FPathQuery>>& InQueries,
+	const TSharedPtr<PCGExPathfinding::FSearchAllocations>& Allocations,
+	const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics) const
+{
+	// A shared tree only matches individual searches if edge scores don't change from one goal to another
+	if (Heuristics->HasAnyFeedback() || Heuristics->HasGoalDependentEdgeScores()) { return false; }
+
+	TSharedPtr<PCGExPathfinding::FSearchAllocations> LocalAllocations = Allocations;
+	if (!LocalAllocations) { LocalAllocations = NewAllocations(); }
+	else { LocalAllocations->Reset(); }
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(UPCGExSearchDijkstra::FindSharedSeedPaths);
+
+	if (bUseRadixQueue) { SearchTree(InQueries, LocalAllocations.Get(), *LocalAllocations->GetRadixQueue(), Heuristics); }
+	else { SearchTree(InQueries, LocalAllocations.Get(), *LocalAllocations->ScoredQueue, Heuristics); }
+
+	return true;
+}
+
+template <typename QueueT>
+void FPCGExSearchOperationDijkstra::SearchTree(
+	const TArray<TSharedPtr<PCGExPathfinding::FPathQuery>>& InQueries,
+	PCGExPathfinding::FSearchAllocations* Allocations,
+	QueueT& ScoredQueue,
+	const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics) const
+{
+	const TArray<PCGExClusters::FNode>& NodesRef = *Cluster->Nodes;
+	const TArray<PCGExGraphs::FEdge>& EdgesRef = *Cluster->Edges;
+
+	const PCGExClusters::FNode& SeedNode = *InQueries[0]->Seed.Node;
+	const PCGExClusters::FNode& AnyGoalNode = *InQueries[0]->Goal.Node; // Edge scores are goal-independent at this point
+
+	PCGEx::TStampedArray<bool>& Visited = Allocations->Visited;
+	const TSharedPtr<PCGEx::FHashLookup> TravelStack = Allocations->TravelStack;
+
+	TSet<int32> PendingGoals;
+	PendingGoals.Reserve(InQueries.Num());
+	for (const TSharedPtr<PCGExPathfinding::FPathQuery>& Query : InQueries) { PendingGoals.Add(Query->Goal.Node->Index); }
+
+	ScoredQueue.Enqueue(SeedNode.Index, 0);
+
+	int32 CurrentNodeIndex;
+	double CurrentScore;
+	while (ScoredQueue.Dequeue(CurrentNodeIndex, CurrentScore))
+	{
+		// A goal's travel stack entry is final once dequeued, same as where a single query would exit early
+		if (bEarlyExit && PendingGoals.Remove(CurrentNodeIndex) && PendingGoals.IsEmpty()) { break; }
+
+		const PCGExClusters::FNode& Current = NodesRef[CurrentNodeIndex];
+
+		if (Visited.IsSet(CurrentNodeIndex)) { continue; }
+		Visited.Set(CurrentNodeIndex, true);
+
+		for (const PCGExGraphs::FLink Lk : Cluster->GetLinks(CurrentNodeIndex))
+		{
+			const uint32 NeighborIndex = Lk.Node;
+			const uint32 EdgeIndex = Lk.Edge;
+
+			if (Visited.IsSet(NeighborIndex)) { continue; }
+
+			const PCGExClusters::FNode& AdjacentNode = NodesRef[NeighborIndex];
+			const PCGExGraphs::FEdge& Edge = EdgesRef[EdgeIndex];
+
+			const double AltScore = CurrentScore + Heuristics->GetEdgeScore(Current, AdjacentNode, Edge, SeedNode, AnyGoalNode, nullptr, TravelStack);
+			if (ScoredQueue.Enqueue(NeighborIndex, AltScore))
+			{
+				TravelStack->Set(NeighborIndex, PCGEx::NH64(CurrentNodeIndex, EdgeIndex));
+			}
+		}
+	}
+
+	for (const TSharedPtr<PCGExPathfinding::FPathQuery>& Query : InQueries)
+	{
+		const int32 GoalIndex = Query->Goal.Node->Index;
+
+		int32 PathNodeIndex = PCGEx::NH64A(TravelStack->Get(GoalIndex));
+		int32 PathEdgeIndex = -1;
+
+		if (PathNodeIndex == -1) { continue; }
+
+		Query->AddPathNode(GoalIndex);
+
+		while (PathNodeIndex != -1)
+		{
+			const int32 CurrentIndex = PathNodeIndex;
+			PCGEx::NH64(TravelStack->Get(CurrentIndex), PathNodeIndex, PathEdgeIndex);
+
+			Query->AddPathNode(CurrentIndex, PathEdgeIndex);
+		}
+	}
+}
+
+void UPCGExSearchDijkstra::CopySettingsFrom(const UPCGExInstancedFactory* Other)
+{
+	Super::CopySettingsFrom(Other);
+	if (const UPCGExSearchDijkstra* TypedOther = Cast<UPCGExSearchDijkstra>(Other))
+	{
+		bUseRadixQueue = TypedOther->bUseRadixQueue;
+	}
+}
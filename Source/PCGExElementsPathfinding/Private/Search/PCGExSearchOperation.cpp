@@ -3,11 +3,15 @@
 
 
 #include "Search/PCGExSearchOperation.h"
+#include "Clusters/PCGExCluster.h"
 #include "Core/PCGExSearchAllocations.h"
 
 void FPCGExSearchOperation::PrepareForCluster(PCGExClusters::FCluster* InCluster)
 {
 	Cluster = InCluster;
+
+	// Searches run many queries per cluster, packed adjacency pays for itself quickly
+	Cluster->GetCSR();
 }
 
 bool FPCGExSearchOperation::ResolveQuery(
@@ -19,6 +23,14 @@ bool FPCGExSearchOperation::ResolveQuery(
 	return false;
 }
 
+bool FPCGExSearchOperation::ResolveSharedSeedQueries(
+	const TArray<TSharedPtr<PCGExPathfinding::FPathQuery>>& InQueries,
+	const TSharedPtr<PCGExPathfinding::FSearchAllocations>& Allocations,
+	const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics) const
+{
+	return false;
+}
+
 TSharedPtr<PCGExPathfinding::FSearchAllocations> FPCGExSearchOperation::NewAllocations() const
 {
 	TSharedPtr<PCGExPathfinding::FSearchAllocations> Allocations = MakeShared<PCGExPathfinding::FSearchAllocations>();
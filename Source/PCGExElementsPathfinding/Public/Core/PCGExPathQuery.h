@@ -78,4 +78,14 @@ namespace PCGExPathfinding
 
 		void Cleanup();
 	};
+
+	/**
+	 * Resolves a set of queries, answering queries that share a seed node from a single search when the operation supports it.
+	 * Falls back to individual searches otherwise. Picks are expected to be resolved beforehand.
+	 */
+	PCGEXELEMENTSPATHFINDING_API void FindSharedSeedPaths(
+		const TArray<TSharedPtr<FPathQuery>>& InQueries,
+		const TSharedPtr<FPCGExSearchOperation>& SearchOperation,
+		const TSharedPtr<FSearchAllocations>& Allocations,
+		const TSharedPtr<PCGExHeuristics::FHandler>& HeuristicsHandler);
 }
@@ -35,6 +35,7 @@ namespace PCGExHeuristics
 namespace PCGExPathfinding
 {
 	class FSearchAllocations;
+	class FSearchAllocationsPool;
 	class FPathQuery;
 
 	class PCGEXELEMENTSPATHFINDING_API FPlotQuery : public TSharedFromThis<FPlotQuery>
@@ -60,7 +61,8 @@ namespace PCGExPathfinding
 			const TSharedPtr<PCGExMT::FTaskManager>& TaskManager,
 			const TSharedPtr<FPCGExSearchOperation>& SearchOperation,
 			const TSharedPtr<FSearchAllocations>& Allocations,
-			const TSharedPtr<PCGExHeuristics::FHandler>& HeuristicsHandler);
+			const TSharedPtr<PCGExHeuristics::FHandler>& HeuristicsHandler,
+			const TSharedPtr<FSearchAllocationsPool>& AllocationsPool = nullptr);
 
 		void Cleanup();
 	};
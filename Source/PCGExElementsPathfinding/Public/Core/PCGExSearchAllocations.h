@@ -4,6 +4,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/PCGExStampedArray.h"
 
 namespace PCGExClusters
 {
@@ -13,25 +14,61 @@ namespace PCGExClusters
 namespace PCGEx
 {
 	class FScoredQueue;
+	class FRadixQueue;
 	class FHashLookup;
 }
 
+class FPCGExSearchOperation;
+
 namespace PCGExPathfinding
 {
+	/**
+	 * Per-query scratch memory. All per-node state is generation-stamped so Reset is O(1) (plus whatever is still queued),
+	 * and allocations are sized by capacity so they can be re-used by any cluster that fits.
+	 */
 	class PCGEXELEMENTSPATHFINDING_API FSearchAllocations : public TSharedFromThis<FSearchAllocations>
 	{
 	protected:
 		int32 NumNodes = 0;
+		int32 Capacity = 0;
+		TSharedPtr<PCGEx::FRadixQueue> RadixQueue;
 
 	public:
 		FSearchAllocations() = default;
+		virtual ~FSearchAllocations() = default;
 
-		TBitArray<> Visited;
-		TArray<double> GScore;
+		PCGEx::TStampedArray<bool> Visited;
+		PCGEx::TStampedArray<double> GScore; // -1 if unset
 		TSharedPtr<PCGEx::FHashLookup> TravelStack;
 		TSharedPtr<PCGEx::FScoredQueue> ScoredQueue;
 
-		void Init(const PCGExClusters::FCluster* InCluster);
-		void Reset();
+		/** Lazily created radix queue, for searches with monotone scores */
+		const TSharedPtr<PCGEx::FRadixQueue>& GetRadixQueue();
+
+		/** (Re)binds these allocations to a cluster; only re-allocates if the cluster exceeds current capacity */
+		virtual void Init(const PCGExClusters::FCluster* InCluster);
+		virtual void Reset();
+
+	protected:
+		virtual void Allocate();
+	};
+
+	/**
+	 * Thread-safe free list of search allocations, shared by all the clusters of an execution.
+	 * Workers acquire allocations for the duration of a scope and release them afterward, so
+	 * queries pay a generation bump instead of an allocation.
+	 * A pool is meant to serve a single search operation type.
+	 */
+	class PCGEXELEMENTSPATHFINDING_API FSearchAllocationsPool : public TSharedFromThis<FSearchAllocationsPool>
+	{
+	protected:
+		FRWLock PoolLock;
+		TArray<TSharedPtr<FSearchAllocations>> Available;
+
+	public:
+		FSearchAllocationsPool() = default;
+
+		TSharedPtr<FSearchAllocations> Acquire(const FPCGExSearchOperation* InOperation);
+		void Release(const TSharedPtr<FSearchAllocations>& InAllocations);
 	};
 }
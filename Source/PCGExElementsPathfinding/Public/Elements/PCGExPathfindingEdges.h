@@ -14,6 +14,7 @@
 namespace PCGExPathfinding
 {
 	class FSearchAllocations;
+	class FSearchAllocationsPool;
 	class FPathQuery;
 }
 
@@ -110,6 +111,10 @@ public:
 	/** If disabled, will share memory allocations between queries, forcing them to execute one after another. Much slower, but very conservative for memory.  Using global feedback forces this behavior under the hood.*/
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Performance, meta=(PCG_NotOverridable, AdvancedDisplay))
 	bool bGreedyQueries = true;
+
+	/** Answer all the goals of a given seed from a single search tree instead of running one search per goal. Results are identical to individual searches; only applies to search algorithms that support it (Dijkstra), and is ignored with feedback or goal-dependent heuristics (Azimuth). */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Performance, meta=(PCG_NotOverridable, AdvancedDisplay))
+	bool bShareSearchTrees = false;
 };
 
 struct FPCGExPathfindingEdgesContext final : FPCGExClustersProcessorContext
@@ -123,6 +128,7 @@ struct FPCGExPathfindingEdgesContext final : FPCGExClustersProcessorContext
 
 	UPCGExGoalPicker* GoalPicker = nullptr;
 	UPCGExSearchInstancedFactory* SearchAlgorithm = nullptr;
+	TSharedPtr<PCGExPathfinding::FSearchAllocationsPool> SearchAllocationsPool;
 
 	FPCGExAttributeToTagDetails SeedAttributesToPathTags;
 	FPCGExAttributeToTagDetails GoalAttributesToPathTags;
@@ -155,6 +161,9 @@ namespace PCGExPathfindingEdges
 		TArray<TSharedPtr<PCGExData::FPointIO>> QueriesIO;
 		TSharedPtr<PCGExPathfinding::FSearchAllocations> SearchAllocations;
 
+		bool bShareSearchTrees = false;
+		TArray<TArray<int32>> SeedGroups; // Query indices sharing the same seed point
+
 	public:
 		FProcessor(const TSharedRef<PCGExData::FFacade>& InVtxDataFacade, const TSharedRef<PCGExData::FFacade>& InEdgeDataFacade)
 			: TProcessor(InVtxDataFacade, InEdgeDataFacade)
@@ -16,6 +16,7 @@
 namespace PCGExPathfinding
 {
 	class FSearchAllocations;
+	class FSearchAllocationsPool;
 	class FPlotQuery;
 }
 
@@ -164,6 +165,7 @@ struct FPCGExPathfindingPlotEdgesContext final : FPCGExClustersProcessorContext
 	TSharedPtr<PCGExData::FPointIOCollection> OutputPaths;
 
 	UPCGExSearchInstancedFactory* SearchAlgorithm = nullptr;
+	TSharedPtr<PCGExPathfinding::FSearchAllocationsPool> SearchAllocationsPool;
 
 	void BuildPath(const TSharedPtr<PCGExPathfinding::FPlotQuery>& Query, const TSharedPtr<PCGExData::FPointIO>& PathIO, const TSharedPtr<PCGExClusters::FClusterDataForwardHandler>& ClusterForwardHandler = nullptr) const;
 
@@ -22,7 +22,14 @@ public:
 		const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics,
 		const TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler>& LocalFeedback = nullptr) const override;
 
-	virtual TSharedPtr<PCGExPathfinding::FSearchAllocations> NewAllocations() const override;
+protected:
+	template <typename QueueT>
+	bool Search(
+		const TSharedPtr<PCGExPathfinding::FPathQuery>& InQuery,
+		PCGExPathfinding::FSearchAllocations* Allocations,
+		QueueT& ScoredQueue,
+		const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics,
+		const PCGExHeuristics::FLocalFeedbackHandler* Feedback) const;
 };
 
 /**
@@ -34,9 +41,16 @@ class UPCGExSearchAStar : public UPCGExSearchInstancedFactory
 	GENERATED_BODY()
 
 public:
+	/** Use a radix bucket queue instead of a binary heap. Faster on large clusters, but only exact if scores never decrease along the search, i.e non-negative edge scores and a consistent heuristic. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, AdvancedDisplay))
+	bool bUseRadixQueue = false;
+
+	virtual void CopySettingsFrom(const UPCGExInstancedFactory* Other) override;
+
 	virtual TSharedPtr<FPCGExSearchOperation> CreateOperation() const override
 	{
 		PCGEX_FACTORY_NEW_OPERATION(SearchOperationAStar)
+		NewOperation->bUseRadixQueue = bUseRadixQueue;
 		return NewOperation;
 	}
 };
@@ -27,8 +27,6 @@ public:
 		const TSharedPtr<PCGExPathfinding::FSearchAllocations>& Allocations,
 		const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics,
 		const TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler>& LocalFeedback = nullptr) const override;
-
-	virtual TSharedPtr<PCGExPathfinding::FSearchAllocations> NewAllocations() const override;
 };
 
 /**
@@ -29,13 +29,15 @@ namespace PCGExPathfinding
 	{
 	public:
 		// Backward search structures
-		TBitArray<> VisitedBackward;
-		TArray<double> GScoreBackward;
+		PCGEx::TStampedArray<bool> VisitedBackward;
+		PCGEx::TStampedArray<double> GScoreBackward;
 		TSharedPtr<PCGEx::FHashLookup> TravelStackBackward;
 		TSharedPtr<PCGEx::FScoredQueue> ScoredQueueBackward;
 
-		void Init(const PCGExClusters::FCluster* InCluster);
-		void Reset();
+		virtual void Reset() override;
+
+	protected:
+		virtual void Allocate() override;
 	};
 }
 
@@ -19,6 +19,27 @@ public:
 		const TSharedPtr<PCGExPathfinding::FSearchAllocations>& Allocations,
 		const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics,
 		const TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler>& LocalFeedback = nullptr) const override;
+
+	virtual bool ResolveSharedSeedQueries(
+		const TArray<TSharedPtr<PCGExPathfinding::FPathQuery>>& InQueries,
+		const TSharedPtr<PCGExPathfinding::FSearchAllocations>& Allocations,
+		const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics) const override;
+
+protected:
+	template <typename QueueT>
+	bool Search(
+		const TSharedPtr<PCGExPathfinding::FPathQuery>& InQuery,
+		PCGExPathfinding::FSearchAllocations* Allocations,
+		QueueT& ScoredQueue,
+		const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics,
+		const PCGExHeuristics::FLocalFeedbackHandler* Feedback) const;
+
+	template <typename QueueT>
+	void SearchTree(
+		const TArray<TSharedPtr<PCGExPathfinding::FPathQuery>>& InQueries,
+		PCGExPathfinding::FSearchAllocations* Allocations,
+		QueueT& ScoredQueue,
+		const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics) const;
 };
 
 /**
@@ -30,9 +51,16 @@ class UPCGExSearchDijkstra : public UPCGExSearchInstancedFactory
 	GENERATED_BODY()
 
 public:
+	/** Use a radix bucket queue instead of a binary heap. Faster on large clusters, but only exact if scores never decrease along the search, i.e non-negative edge scores. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, AdvancedDisplay))
+	bool bUseRadixQueue = false;
+
+	virtual void CopySettingsFrom(const UPCGExInstancedFactory* Other) override;
+
 	virtual TSharedPtr<FPCGExSearchOperation> CreateOperation() const override
 	{
 		PCGEX_FACTORY_NEW_OPERATION(SearchOperationDijkstra)
+		NewOperation->bUseRadixQueue = bUseRadixQueue;
 		return NewOperation;
 	}
 };
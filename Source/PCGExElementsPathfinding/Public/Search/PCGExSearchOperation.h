@@ -36,6 +36,7 @@ class FPCGExSearchOperation : public FPCGExOperation
 {
 public:
 	bool bEarlyExit = true;
+	bool bUseRadixQueue = false;
 	PCGExClusters::FCluster* Cluster = nullptr;
 
 	virtual void PrepareForCluster(PCGExClusters::FCluster* InCluster);
@@ -45,6 +46,15 @@ public:
 		const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics,
 		const TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler>& LocalFeedback = nullptr) const;
 
+	/**
+	 * Resolve queries that all start from the same seed node using a single search.
+	 * Returns false if the operation (or the heuristics) can't share a search, in which case queries must be resolved one by one.
+	 */
+	virtual bool ResolveSharedSeedQueries(
+		const TArray<TSharedPtr<PCGExPathfinding::FPathQuery>>& InQueries,
+		const TSharedPtr<PCGExPathfinding::FSearchAllocations>& Allocations,
+		const TSharedPtr<PCGExHeuristics::FHandler>& Heuristics) const;
+
 	virtual TSharedPtr<PCGExPathfinding::FSearchAllocations> NewAllocations() const;
 };
 
@@ -41,7 +41,7 @@ TArray<FPCGPinProperties> UPCGExPathCrossingsSettings::InputPinProperties() cons
 }
 
 PCGEX_INITIALIZE_ELEMENT(PathCrossings)
-PCGEX_ELEMENT_BATCH_POINT_IMPL(PathCrossings)
+PCGEX_ELEMENT_BATCH_POINT_IMPL_ADV(PathCrossings)
 
 bool FPCGExPathCrossingsElement::Boot(FPCGExContext* InContext) const
 {
@@ -186,9 +186,13 @@ namespace PCGExPathCrossings
 		CanCutFilterManager.Reset();
 		CanBeCutFilterManager.Reset();
 
-		if (bCanCut) { Path->BuildPartialEdgeOctree(CanCut); }
+		if (bSelfIntersectionOnly)
+		{
+			if (bCanCut) { Path->BuildPartialEdgeOctree(CanCut); }
+			CanCut.Empty();
+		}
 
-		CanCut.Empty();
+		// Otherwise cuttable edges are gathered by the batch into a single, shared BVH
 
 		return true;
 	}
@@ -206,31 +210,13 @@ namespace PCGExPathCrossings
 		const TSharedPtr<PCGExPointsMT::IBatch> Parent = ParentBatch.Pin();
 		if (!Parent) { return; }
 
-		const TSharedPtr<PCGExPointsMT::TBatch<FProcessor>> TypedParent = StaticCastSharedPtr<PCGExPointsMT::TBatch<FProcessor>>(Parent);
-
-		TArray<TSharedPtr<PCGExPaths::FPath>> Cutters;
+		const TSharedPtr<FBatch> TypedParent = StaticCastSharedPtr<FBatch>(Parent);
 
 		if (bSelfIntersectionOnly)
 		{
-			if (bCanCut && Path->GetEdgeOctree()) { Cutters.Add(Path); }
+			if (!bCanCut || !Path->GetEdgeOctree()) { return; }
 		}
-		else
-		{
-			Cutters.Reserve(Parent->ProcessorFacades.Num());
-
-
-			for (int Pi = 0; Pi < TypedParent->GetNumProcessors(); Pi++)
-			{
-				const TSharedPtr<FProcessor> P = TypedParent->GetProcessor<FProcessor>(Pi);
-
-				if (!Details.bEnableSelfIntersection && P.Get() == this) { continue; }
-				if (!P->bCanCut || !P->Path->GetEdgeOctree()) { continue; }
-
-				Cutters.Add(P->Path);
-			}
-		}
-
-		if (Cutters.IsEmpty()) { return; }
+		else if (TypedParent->EdgeBVH.IsEmpty()) { return; }
 
 		PCGEX_SCOPE_LOOP(Index)
 		{
@@ -243,11 +229,25 @@ namespace PCGExPathCrossings
 
 			const TSharedPtr<PCGExPaths::FPathEdgeCrossings> NewCrossing = MakeShared<PCGExPaths::FPathEdgeCrossings>(Index);
 
-			for (const TSharedPtr<PCGExPaths::FPath>& OtherPath : Cutters)
+			if (bSelfIntersectionOnly)
+			{
+				Path->GetEdgeOctree()->FindElementsWithBoundsTest(Edge.Bounds.GetBox(), [&](const PCGExPaths::FPathEdge* OtherEdge)
+				{
+					NewCrossing->FindSplit(Path, Edge, PathLength, Path, *OtherEdge, Details);
+				});
+			}
+			else
 			{
-				OtherPath->GetEdgeOctree()->FindElementsWithBoundsTest(Edge.Bounds.GetBox(), [&](const PCGExPaths::FPathEdge* OtherEdge)
+				TypedParent->EdgeBVH.ForEachOverlapping(Edge.Bounds.GetBox(), [&](const int32 Item)
 				{
-					NewCrossing->FindSplit(Path, Edge, PathLength, OtherPath, *OtherEdge, Details);
+					uint32 ProcessorIndex;
+					uint32 EdgeIndex;
+					PCGEx::H64(TypedParent->EdgeRefs[Item], ProcessorIndex, EdgeIndex);
+
+					const TSharedPtr<PCGExPaths::FPath>& OtherPath = TypedParent->CutterPaths[ProcessorIndex];
+					if (!Details.bEnableSelfIntersection && OtherPath == Path) { return; }
+
+					NewCrossing->FindSplit(Path, Edge, PathLength, OtherPath, OtherPath->Edges[EdgeIndex], Details);
 				});
 			}
 
@@ -509,6 +509,56 @@ namespace PCGExPathCrossings
 
 		CrossBlendTask->StartSubLoops(Path->NumEdges, PCGEX_CORE_SETTINGS.GetPointsBatchChunkSize());
 	}
+
+	void FBatch::CompleteWork()
+	{
+		PCGEX_TYPED_CONTEXT_AND_SETTINGS(PathCrossings)
+
+		if (!bSkipCompletion && !Settings->bSelfIntersectionOnly) { BuildEdgeBVH(); }
+
+		TBatch<FProcessor>::CompleteWork();
+	}
+
+	void FBatch::BuildEdgeBVH()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExPathCrossings::FBatch::BuildEdgeBVH);
+
+		const int32 NumProcessors = GetNumProcessors();
+		CutterPaths.Init(nullptr, NumProcessors);
+
+		int32 NumEdges = 0;
+		for (int Pi = 0; Pi < NumProcessors; Pi++)
+		{
+			const TSharedPtr<FProcessor> P = GetProcessor<FProcessor>(Pi);
+			if (P->bIsProcessorValid && P->bCanCut && P->Path) { NumEdges += P->Path->NumEdges; }
+		}
+
+		TArray<FBox> Boxes;
+		Boxes.Reserve(NumEdges);
+		EdgeRefs.Reset(NumEdges);
+
+		for (int Pi = 0; Pi < NumProcessors; Pi++)
+		{
+			const TSharedPtr<FProcessor> P = GetProcessor<FProcessor>(Pi);
+			if (!P->bIsProcessorValid || !P->bCanCut || !P->Path) { continue; }
+
+			const TSharedPtr<PCGExPaths::FPath>& OtherPath = P->Path;
+			CutterPaths[Pi] = OtherPath;
+
+			for (int i = 0; i < OtherPath->NumEdges; i++)
+			{
+				const PCGExPaths::FPathEdge& Edge = OtherPath->Edges[i];
+				if (!P->CanCut[i] || !OtherPath->IsEdgeValid(Edge)) { continue; } // Skip filtered out & zero-length edges
+
+				Boxes.Add(Edge.Bounds.GetBox());
+				EdgeRefs.Add(PCGEx::H64(Pi, i));
+			}
+
+			P->CanCut.Empty();
+		}
+
+		EdgeBVH.Build(Boxes);
+	}
 }
 
 #undef LOCTEXT_NAMESPACE
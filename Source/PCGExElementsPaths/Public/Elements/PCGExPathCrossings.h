@@ -7,6 +7,7 @@
 #include "Core/PCGExPathProcessor.h"
 #include "Core/PCGExPointsProcessor.h"
 #include "Details/PCGExBlendingDetails.h"
+#include "Math/PCGExBoxBVH.h"
 #include "Math/PCGExMathAxis.h"
 #include "Paths/PCGExPath.h"
 #include "Paths/PCGExPathIntersectionDetails.h"
@@ -177,8 +178,12 @@ protected:
 
 namespace PCGExPathCrossings
 {
+	class FBatch;
+
 	class FProcessor final : public PCGExPointsMT::TProcessor<FPCGExPathCrossingsContext, UPCGExPathCrossingsSettings>
 	{
+		friend class FBatch;
+
 		bool bClosedLoop = false;
 		bool bSelfIntersectionOnly = false;
 		bool bCanCut = true;
@@ -230,4 +235,25 @@ namespace PCGExPathCrossings
 
 		virtual void Write() override;
 	};
+
+	class FBatch final : public PCGExPointsMT::TBatch<FProcessor>
+	{
+		friend class FProcessor;
+
+		// Cuttable edges of every path, shared by all processors
+		PCGExMath::FBoxBVH EdgeBVH;
+		TArray<uint64> EdgeRefs; // Processor index & edge index, per BVH item
+		TArray<TSharedPtr<PCGExPaths::FPath>> CutterPaths;
+
+	public:
+		explicit FBatch(FPCGExContext* InContext, const TArray<TWeakPtr<PCGExData::FPointIO>>& InPointsCollection)
+			: TBatch(InContext, InPointsCollection)
+		{
+		}
+
+		virtual void CompleteWork() override;
+
+	protected:
+		void BuildEdgeBVH();
+	};
 }
@@ -5,6 +5,7 @@
 #include "Core/PCGExProbeOperation.h"
 
 
+#include "Containers/PCGExScopedContainers.h"
 #include "Details/PCGExSettingsDetails.h"
 #include "Core/PCGExProbingCandidates.h"
 #include "Data/PCGExData.h"
@@ -60,6 +61,31 @@ void FPCGExProbeOperation::ProcessAll(TSet<uint64>& OutEdges) const
 {
 }
 
+bool FPCGExProbeOperation::SupportsScopedProcessing() const { return false; }
+
+int32 FPCGExProbeOperation::GetNumScopedPasses() const { return 1; }
+
+void FPCGExProbeOperation::PrepareScopedProcessing(const TArray<PCGExMT::FScope>& Loops)
+{
+	ScopedEdges = MakeShared<PCGExMT::TScopedSet<uint64>>(Loops, 10);
+}
+
+void FPCGExProbeOperation::ProcessScope(const int32 Pass, const PCGExMT::FScope& Scope, TSet<uint64>& OutEdges)
+{
+}
+
+void FPCGExProbeOperation::CompleteScopedProcessing(TSet<uint64>& OutEdges)
+{
+	if (!ScopedEdges) { return; }
+	ScopedEdges->Collapse(OutEdges);
+	ScopedEdges.Reset();
+}
+
+TSet<uint64>& FPCGExProbeOperation::GetScopedEdges(const PCGExMT::FScope& Scope) const
+{
+	return ScopedEdges->Get_Ref(Scope);
+}
+
 double FPCGExProbeOperation::GetSearchRadius(const int32 Index) const
 {
 	return FMath::Square(SearchRadius->Read(Index) + SearchRadiusOffset);
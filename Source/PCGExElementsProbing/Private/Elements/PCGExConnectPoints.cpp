@@ -156,7 +156,8 @@ namespace PCGExConnectPoints
 
 			if (NewOperation->IsGlobalProbe())
 			{
-				GlobalOperations.Add(NewOperation.Get());
+				if (NewOperation->SupportsScopedProcessing()) { ScopedGlobalOperations.Add(NewOperation.Get()); }
+				else { GlobalOperations.Add(NewOperation.Get()); }
 				continue;
 			}
 
@@ -185,7 +186,7 @@ namespace PCGExConnectPoints
 
 		bOnlyGlobalOps = RadiusSources.IsEmpty() && DirectOperations.IsEmpty();
 
-		if (bOnlyGlobalOps && GlobalOperations.IsEmpty()) { return false; }
+		if (bOnlyGlobalOps && GlobalOperations.IsEmpty() && ScopedGlobalOperations.IsEmpty()) { return false; }
 
 		if (!PointDataFacade->Source->InitializeOutput<UPCGExClusterNodesData>(PCGExData::EIOInit::New)) { return false; }
 		GraphBuilder = MakeShared<PCGExGraphs::FGraphBuilder>(PointDataFacade, &Settings->GraphBuilderDetails);
@@ -284,7 +285,7 @@ namespace PCGExConnectPoints
 		GeneratorsFilter.Reset();
 		ConnectableFilter.Reset();
 
-		NumCompletions = GlobalOperations.IsEmpty() ? 0 : 1;
+		NumCompletions = (GlobalOperations.IsEmpty() ? 0 : 1) + ScopedGlobalOperations.Num();
 		if (!bOnlyGlobalOps)
 		{
 			NumCompletions++;
@@ -313,6 +314,43 @@ namespace PCGExConnectPoints
 
 			GlobalOpsTasks->StartSimpleCallbacks();
 		}
+
+		for (FPCGExProbeOperation* Operation : ScopedGlobalOperations) { ProcessScopedGlobalOperation(Operation, 0); }
+	}
+
+	void FProcessor::ProcessScopedGlobalOperation(FPCGExProbeOperation* Operation, const int32 Pass)
+	{
+		if (Pass >= Operation->GetNumScopedPasses())
+		{
+			TSet<uint64> LocalEdges;
+			Operation->CompleteScopedProcessing(LocalEdges);
+			if (!LocalEdges.IsEmpty()) { AppendEdges(LocalEdges); }
+			AdvanceCompletion();
+			return;
+		}
+
+		PCGEX_ASYNC_GROUP_CHKD_VOID(TaskManager, GlobalOpPass)
+
+		if (Pass == 0)
+		{
+			GlobalOpPass->OnPrepareSubLoopsCallback = [Operation](const TArray<PCGExMT::FScope>& Loops)
+			{
+				Operation->PrepareScopedProcessing(Loops);
+			};
+		}
+
+		GlobalOpPass->OnSubLoopStartCallback = [Operation, Pass](const PCGExMT::FScope& Scope)
+		{
+			Operation->ProcessScope(Pass, Scope, Operation->GetScopedEdges(Scope));
+		};
+
+		GlobalOpPass->OnCompleteCallback = [PCGEX_ASYNC_THIS_CAPTURE, Operation, Pass]()
+		{
+			PCGEX_ASYNC_THIS
+			This->ProcessScopedGlobalOperation(Operation, Pass + 1);
+		};
+
+		GlobalOpPass->StartSubLoops(WorkingPositions.Num(), PCGEX_CORE_SETTINGS.GetPointsBatchChunkSize());
 	}
 
 	void FProcessor::PrepareLoopScopesForPoints(const TArray<PCGExMT::FScope>& Loops)
@@ -2,6 +2,7 @@
 // Released under the MIT license https://opensource.org/license/MIT/
 
 #include "Probes/PCGExGlobalProbeDBSCAN.h"
+#include "Core/PCGExMTCommon.h"
 #include "Data/PCGExPointIO.h"
 
 PCGEX_CREATE_PROBE_FACTORY(DBSCAN, {}, {})
@@ -14,48 +15,60 @@ bool FPCGExProbeDBSCAN::Prepare(FPCGExContext* InContext)
 	return FPCGExProbeOperation::Prepare(InContext);
 }
 
-void FPCGExProbeDBSCAN::ProcessAll(TSet<uint64>& OutEdges) const
+bool FPCGExProbeDBSCAN::SupportsScopedProcessing() const { return true; }
+
+int32 FPCGExProbeDBSCAN::GetNumScopedPasses() const { return 2; }
+
+void FPCGExProbeDBSCAN::PrepareScopedProcessing(const TArray<PCGExMT::FScope>& Loops)
+{
+	FPCGExProbeOperation::PrepareScopedProcessing(Loops);
+
+	const int32 NumPoints = WorkingPositions->Num();
+	Neighborhoods.SetNum(NumPoints);
+	IsCore.Init(false, NumPoints);
+}
+
+void FPCGExProbeDBSCAN::ProcessScope(const int32 Pass, const PCGExMT::FScope& Scope, TSet<uint64>& OutEdges)
 {
 	const TArray<FVector>& Positions = *WorkingPositions;
-	const int32 NumPoints = Positions.Num();
-	if (NumPoints < 2) { return; }
+	if (Positions.Num() < 2) { return; }
 
 	const TArray<int8>& CanGenerateRef = *CanGenerate;
 	const TArray<int8>& AcceptConnectionsRef = *AcceptConnections;
 
-	// First pass: identify core points and their neighbors
-	TArray<TArray<int32>> Neighborhoods;
-	TArray<bool> IsCore;
-	Neighborhoods.SetNum(NumPoints);
-	IsCore.Init(false, NumPoints);
-
-	for (int32 i = 0; i < NumPoints; ++i)
+	if (Pass == 0)
 	{
-		if (!CanGenerateRef[i] && !AcceptConnectionsRef[i]) { continue; }
-
-		const FVector& Pos = Positions[i];
-		const double MaxDistSq = GetSearchRadius(i);
-		const double MaxDist = FMath::Sqrt(MaxDistSq);
+		// First pass: identify core points and their neighbors
+		PCGEX_SCOPE_LOOP(i)
+		{
+			if (!CanGenerateRef[i] && !AcceptConnectionsRef[i]) { continue; }
 
-		Octree->FindElementsWithBoundsTest(
-			FBox(Pos - FVector(MaxDist), Pos + FVector(MaxDist)),
-			[&](const PCGExOctree::FItem& Other)
-			{
-				const int32 j = Other.Index;
-				if (i == j) { return; }
-				if (!CanGenerateRef[j] && !AcceptConnectionsRef[j]) { return; }
+			const FVector& Pos = Positions[i];
+			const double MaxDistSq = GetSearchRadius(i);
+			const double MaxDist = FMath::Sqrt(MaxDistSq);
 
-				if (FVector::DistSquared(Pos, Positions[j]) <= MaxDistSq)
+			Octree->FindElementsWithBoundsTest(
+				FBox(Pos - FVector(MaxDist), Pos + FVector(MaxDist)),
+				[&](const PCGExOctree::FItem& Other)
 				{
-					Neighborhoods[i].Add(j);
-				}
-			});
+					const int32 j = Other.Index;
+					if (i == j) { return; }
+					if (!CanGenerateRef[j] && !AcceptConnectionsRef[j]) { return; }
+
+					if (FVector::DistSquared(Pos, Positions[j]) <= MaxDistSq)
+					{
+						Neighborhoods[i].Add(j);
+					}
+				});
 
-		IsCore[i] = Neighborhoods[i].Num() >= Config.MinPoints;
+			IsCore[i] = Neighborhoods[i].Num() >= Config.MinPoints;
+		}
+
+		return;
 	}
 
-	// Second pass: create edges
-	for (int32 i = 0; i < NumPoints; ++i)
+	// Second pass: create edges, once all core points are known
+	PCGEX_SCOPE_LOOP(i)
 	{
 		if (!CanGenerateRef[i]) { continue; }
 
@@ -110,3 +123,11 @@ void FPCGExProbeDBSCAN::ProcessAll(TSet<uint64>& OutEdges) const
 		}
 	}
 }
+
+void FPCGExProbeDBSCAN::CompleteScopedProcessing(TSet<uint64>& OutEdges)
+{
+	FPCGExProbeOperation::CompleteScopedProcessing(OutEdges);
+
+	Neighborhoods.Empty();
+	IsCore.Empty();
+}
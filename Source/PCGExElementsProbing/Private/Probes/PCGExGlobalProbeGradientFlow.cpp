@@ -4,6 +4,7 @@
 #include "Probes/PCGExGlobalProbeGradientFlow.h"
 
 #include "Data/PCGExData.h"
+#include "Core/PCGExMTCommon.h"
 #include "Data/PCGExPointIO.h"
 
 PCGEX_CREATE_PROBE_FACTORY(GradientFlow, {}, {})
@@ -22,22 +23,17 @@ bool FPCGExProbeGradientFlow::Prepare(FPCGExContext* InContext)
 	return true;
 }
 
-void FPCGExProbeGradientFlow::ProcessAll(TSet<uint64>& OutEdges) const
+bool FPCGExProbeGradientFlow::SupportsScopedProcessing() const { return true; }
+
+void FPCGExProbeGradientFlow::ProcessScope(const int32 Pass, const PCGExMT::FScope& Scope, TSet<uint64>& OutEdges)
 {
 	const TArray<FVector>& Positions = *WorkingPositions;
-	const int32 NumPoints = Positions.Num();
-	if (NumPoints < 2) { return; }
-
-	const TArray<int8> CanGenerateRef = *CanGenerate;
-	const TArray<int8> AcceptConnectionsRef = *AcceptConnections;
-
-	// TODO : Use octree for faster queries, this is crude
+	if (Positions.Num() < 2) { return; }
 
-	// For each point, find K nearest neighbors
-	TArray<TPair<double, int32>> Distances;
-	Distances.SetNum(NumPoints);
+	const TArray<int8>& CanGenerateRef = *CanGenerate;
+	const TArray<int8>& AcceptConnectionsRef = *AcceptConnections;
 
-	for (int32 i = 0; i < NumPoints; ++i)
+	PCGEX_SCOPE_LOOP(i)
 	{
 		if (!CanGenerateRef[i]) { continue; }
 
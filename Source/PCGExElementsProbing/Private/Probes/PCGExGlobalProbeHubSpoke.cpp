@@ -2,8 +2,14 @@
 // Released under the MIT license https://opensource.org/license/MIT/
 
 #include "Probes/PCGExGlobalProbeHubSpoke.h"
+
+#include "PCGExCoreSettingsCache.h"
+#include "Async/ParallelFor.h"
+#include "Containers/PCGExScopedContainers.h"
+#include "Core/PCGExMT.h"
 #include "Data/PCGExData.h"
 #include "Data/PCGExPointIO.h"
+#include "Math/PCGExKDTree.h"
 
 PCGEX_CREATE_PROBE_FACTORY(HubSpoke, {}, {})
 
@@ -30,33 +36,34 @@ void FPCGExProbeHubSpoke::SelectHubsByDensity(TArray<int32>& OutHubs) const
 
 	// Compute local density (inverse of average distance to K nearest neighbors)
 	constexpr int32 DensityK = 5;
-	TArray<TPair<double, int32>> DensityScores;
-	DensityScores.Reserve(NumPoints);
 
-	TArray<double> Distances;
-	Distances.SetNum(NumPoints);
+	PCGExMath::FKDTree Tree;
+	Tree.Build(Positions);
 
-	for (int32 i = 0; i < NumPoints; ++i)
-	{
-		if (!CanGenerateRef[i]) { continue; }
+	TArray<double> Densities;
+	Densities.Init(-1, NumPoints);
 
-		for (int32 j = 0; j < NumPoints; ++j)
+	ParallelFor(
+		NumPoints, [&](const int32 i)
 		{
-			Distances[j] = (j != i) ? FVector::DistSquared(Positions[i], Positions[j]) : MAX_dbl;
-		}
+			if (!CanGenerateRef[i]) { return; }
 
-		Algo::Sort(Distances);
+			TArray<PCGExMath::FKDTree::FNearest> Nearest;
+			Tree.FindKNearest(Positions[i], DensityK, Nearest, [&](const int32 j) { return j != i; });
 
-		double AvgDist = 0;
-		const int32 K = FMath::Min(DensityK, NumPoints - 1);
-		for (int32 k = 0; k < K; ++k)
-		{
-			AvgDist += FMath::Sqrt(Distances[k]);
-		}
-		AvgDist /= K;
+			const int32 K = Nearest.Num();
+			if (!K) { return; }
 
-		DensityScores.Add({1.0 / FMath::Max(AvgDist, SMALL_NUMBER), i});
-	}
+			double AvgDist = 0;
+			for (const PCGExMath::FKDTree::FNearest& N : Nearest) { AvgDist += FMath::Sqrt(N.DistSquared); }
+			AvgDist /= K;
+
+			Densities[i] = 1.0 / FMath::Max(AvgDist, SMALL_NUMBER);
+		});
+
+	TArray<TPair<double, int32>> DensityScores;
+	DensityScores.Reserve(NumPoints);
+	for (int32 i = 0; i < NumPoints; ++i) { if (Densities[i] >= 0) { DensityScores.Add({Densities[i], i}); } }
 
 	// Sort by density (highest first)
 	Algo::Sort(DensityScores, [](const auto& A, const auto& B) { return A.Key > B.Key; });
@@ -99,34 +106,38 @@ void FPCGExProbeHubSpoke::SelectHubsByCentrality(TArray<int32>& OutHubs) const
 	const TArray<int8>& CanGenerateRef = *CanGenerate;
 
 	// Compute centrality: points closest to local centroid of neighborhood
-	TArray<TPair<double, int32>> CentralityScores;
-	CentralityScores.Reserve(NumPoints);
+	PCGExMath::FKDTree Tree;
+	Tree.Build(Positions);
 
-	for (int32 i = 0; i < NumPoints; ++i)
-	{
-		if (!CanGenerateRef[i]) { continue; }
-
-		// Compute centroid of points within radius
-		const double Radius = GetSearchRadius(i);
-		FVector Centroid = FVector::ZeroVector;
-		int32 Count = 0;
+	TArray<double> Centralities;
+	Centralities.Init(-1, NumPoints);
 
-		for (int32 j = 0; j < NumPoints; ++j)
+	ParallelFor(
+		NumPoints, [&](const int32 i)
 		{
-			if (FVector::DistSquared(Positions[i], Positions[j]) <= Radius)
+			if (!CanGenerateRef[i]) { return; }
+
+			// Compute centroid of points within radius
+			FVector Centroid = FVector::ZeroVector;
+			int32 Count = 0;
+
+			Tree.ForEachInRadius(
+				Positions[i], GetSearchRadius(i), [&](const int32 j, const double)
+				{
+					Centroid += Positions[j];
+					Count++;
+				});
+
+			if (Count > 0)
 			{
-				Centroid += Positions[j];
-				Count++;
+				Centroid /= Count;
+				Centralities[i] = FVector::Dist(Positions[i], Centroid); // Lower is more central
 			}
-		}
+		});
 
-		if (Count > 0)
-		{
-			Centroid /= Count;
-			const double DistToCentroid = FVector::Dist(Positions[i], Centroid);
-			CentralityScores.Add({DistToCentroid, i}); // Lower is more central
-		}
-	}
+	TArray<TPair<double, int32>> CentralityScores;
+	CentralityScores.Reserve(NumPoints);
+	for (int32 i = 0; i < NumPoints; ++i) { if (Centralities[i] >= 0) { CentralityScores.Add({Centralities[i], i}); } }
 
 	Algo::Sort(CentralityScores, [](const auto& A, const auto& B) { return A.Key < B.Key; });
 
@@ -177,24 +188,25 @@ void FPCGExProbeHubSpoke::SelectHubsByKMeans(TArray<int32>& OutHubs) const
 	for (int32 Iter = 0; Iter < Config.KMeansIterations; ++Iter)
 	{
 		// Assignment step
-		for (int32 i = 0; i < NumPoints; ++i)
-		{
-			if (!CanGenerateRef[i]) { continue; }
+		ParallelFor(
+			NumPoints, [&](const int32 i)
+			{
+				if (!CanGenerateRef[i]) { return; }
 
-			double BestDist = MAX_dbl;
-			int32 BestCluster = 0;
+				double BestDist = MAX_dbl;
+				int32 BestCluster = 0;
 
-			for (int32 c = 0; c < K; ++c)
-			{
-				const double Dist = FVector::DistSquared(Positions[i], Centroids[c]);
-				if (Dist < BestDist)
+				for (int32 c = 0; c < K; ++c)
 				{
-					BestDist = Dist;
-					BestCluster = c;
+					const double Dist = FVector::DistSquared(Positions[i], Centroids[c]);
+					if (Dist < BestDist)
+					{
+						BestDist = Dist;
+						BestCluster = c;
+					}
 				}
-			}
-			Assignments[i] = BestCluster;
-		}
+				Assignments[i] = BestCluster;
+			});
 
 		// Update step
 		TArray<FVector> NewCentroids;
@@ -219,27 +231,14 @@ void FPCGExProbeHubSpoke::SelectHubsByKMeans(TArray<int32>& OutHubs) const
 	}
 
 	// Find point closest to each centroid
+	PCGExMath::FKDTree Tree;
+	Tree.Build(Positions);
+
 	for (int32 c = 0; c < K; ++c)
 	{
 		double BestDist = MAX_dbl;
-		int32 BestPoint = INDEX_NONE;
-
-		for (int32 i = 0; i < NumPoints; ++i)
-		{
-			if (!CanGenerateRef[i]) { continue; }
-
-			const double Dist = FVector::DistSquared(Positions[i], Centroids[c]);
-			if (Dist < BestDist)
-			{
-				BestDist = Dist;
-				BestPoint = i;
-			}
-		}
-
-		if (BestPoint != INDEX_NONE)
-		{
-			OutHubs.Add(BestPoint);
-		}
+		const int32 BestPoint = Tree.FindNearest(Centroids[c], BestDist, [&](const int32 i) { return CanGenerateRef[i] != 0; });
+		if (BestPoint != INDEX_NONE) { OutHubs.Add(BestPoint); }
 	}
 }
 
@@ -291,47 +290,54 @@ void FPCGExProbeHubSpoke::ProcessAll(TSet<uint64>& OutEdges) const
 	}
 
 	// Connect spokes to hubs
-	for (int32 i = 0; i < NumPoints; ++i)
-	{
-		if (HubSet.Contains(i)) { continue; }
-		if (!CanGenerateRef[i] && !AcceptConnectionsRef[i]) { continue; }
+	// Hub tree items are indices into Hubs
+	TArray<FVector> HubPositions;
+	HubPositions.Reserve(Hubs.Num());
+	for (const int32 Hub : Hubs) { HubPositions.Add(Positions[Hub]); }
 
-		const double MaxDistSq = GetSearchRadius(i);
+	PCGExMath::FKDTree HubTree;
+	HubTree.Build(HubPositions);
 
-		if (Config.bNearestHubOnly)
+	TArray<PCGExMT::FScope> Scopes;
+	PCGExMT::SubLoopScopes(Scopes, NumPoints, PCGEX_CORE_SETTINGS.GetPointsBatchChunkSize());
+
+	const TSharedPtr<PCGExMT::TScopedSet<uint64>> ScopedEdges = MakeShared<PCGExMT::TScopedSet<uint64>>(Scopes, 0);
+
+	ParallelFor(
+		Scopes.Num(), [&](const int32 ScopeIndex)
 		{
-			// Find nearest hub
-			double BestDist = MAX_dbl;
-			int32 BestHub = INDEX_NONE;
+			const PCGExMT::FScope& Scope = Scopes[ScopeIndex];
+			TSet<uint64>& LocalEdges = ScopedEdges->Get_Ref(Scope);
 
-			for (const int32 Hub : Hubs)
+			PCGEX_SCOPE_LOOP(i)
 			{
-				const double Dist = FVector::DistSquared(Positions[i], Positions[Hub]);
-				if (Dist < BestDist && Dist <= MaxDistSq)
+				if (HubSet.Contains(i)) { continue; }
+				if (!CanGenerateRef[i] && !AcceptConnectionsRef[i]) { continue; }
+
+				const double MaxDistSq = GetSearchRadius(i);
+
+				if (Config.bNearestHubOnly)
 				{
-					BestDist = Dist;
-					BestHub = Hub;
-				}
-			}
+					// Find nearest hub
+					double BestDist = MAX_dbl;
+					const int32 BestItem = HubTree.FindNearest(Positions[i], BestDist);
+					if (BestItem == INDEX_NONE || BestDist > MaxDistSq) { continue; }
 
-			if (BestHub != INDEX_NONE && (CanGenerateRef[i] || CanGenerateRef[BestHub]))
-			{
-				OutEdges.Add(PCGEx::H64U(i, BestHub));
-			}
-		}
-		else
-		{
-			// Connect to all hubs within radius
-			for (const int32 Hub : Hubs)
-			{
-				if (FVector::DistSquared(Positions[i], Positions[Hub]) <= MaxDistSq)
+					const int32 BestHub = Hubs[BestItem];
+					if (CanGenerateRef[i] || CanGenerateRef[BestHub]) { LocalEdges.Add(PCGEx::H64U(i, BestHub)); }
+				}
+				else
 				{
-					if (CanGenerateRef[i] || CanGenerateRef[Hub])
-					{
-						OutEdges.Add(PCGEx::H64U(i, Hub));
-					}
+					// Connect to all hubs within radius
+					HubTree.ForEachInRadius(
+						Positions[i], MaxDistSq, [&](const int32 Item, const double)
+						{
+							const int32 Hub = Hubs[Item];
+							if (CanGenerateRef[i] || CanGenerateRef[Hub]) { LocalEdges.Add(PCGEx::H64U(i, Hub)); }
+						});
 				}
 			}
-		}
-	}
+		});
+
+	ScopedEdges->Collapse(OutEdges);
 }
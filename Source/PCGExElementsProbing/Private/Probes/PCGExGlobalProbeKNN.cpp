@@ -3,8 +3,13 @@
 
 #include "Probes/PCGExGlobalProbeKNN.h"
 
+#include "PCGExCoreSettingsCache.h"
+#include "Async/ParallelFor.h"
+#include "Containers/PCGExScopedContainers.h"
+#include "Core/PCGExMT.h"
 #include "Data/PCGExPointIO.h"
 #include "Details/PCGExSettingsDetails.h"
+#include "Math/PCGExKDTree.h"
 
 PCGEX_CREATE_PROBE_FACTORY(KNN, {}, {})
 
@@ -22,63 +27,75 @@ bool FPCGExProbeKNN::Prepare(FPCGExContext* InContext)
 
 void FPCGExProbeKNN::ProcessAll(TSet<uint64>& OutEdges) const
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExProbeKNN::ProcessAll);
+
 	const TArray<FVector>& Positions = *WorkingPositions;
 	const int32 NumPoints = Positions.Num();
 	if (NumPoints < 2) { return; }
 
-	const TArray<int8> CanGenerateRef = *CanGenerate;
-	const TArray<int8> AcceptConnectionsRef = *AcceptConnections;
-
-	// TODO : Use octree for faster queries, this is crude
+	const TArray<int8>& CanGenerateRef = *CanGenerate;
+	const TArray<int8>& AcceptConnectionsRef = *AcceptConnections;
 
-	// For each point, find K nearest neighbors
-	TArray<TPair<float, int32>> Distances;
-	Distances.SetNum(NumPoints);
+	PCGExMath::FKDTree Tree;
+	Tree.Build(Positions);
 
 	const bool bMutual = Config.Mode == EPCGExProbeKNNMode::Mutual;
 
-	// Build neighbor sets for each point
-	TArray<TSet<int32>> NeighborSets;
-	if (bMutual) { NeighborSets.SetNum(NumPoints); }
+	// Neighbors of each point, nearest first
+	TArray<TArray<int32>> Neighbors;
+	if (bMutual) { Neighbors.SetNum(NumPoints); }
 
-	for (int32 i = 0; i < NumPoints; ++i)
-	{
-		if (!CanGenerateRef[i]) { continue; }
+	TArray<PCGExMT::FScope> Scopes;
+	PCGExMT::SubLoopScopes(Scopes, NumPoints, PCGEX_CORE_SETTINGS.GetPointsBatchChunkSize());
 
-		const int32 ActualK = FMath::Min(K->Read(i), NumPoints - 1);
+	const TSharedPtr<PCGExMT::TScopedSet<uint64>> ScopedEdges = MakeShared<PCGExMT::TScopedSet<uint64>>(Scopes, bMutual ? 0 : -5);
 
-		// Compute distances to all other points
-		for (int32 j = 0; j < NumPoints; ++j)
+	ParallelFor(
+		Scopes.Num(), [&](const int32 ScopeIndex)
 		{
-			Distances[j] = {(AcceptConnectionsRef[j] && j != i) ? FVector::DistSquared(Positions[i], Positions[j]) : MAX_dbl, j};
-		}
+			const PCGExMT::FScope& Scope = Scopes[ScopeIndex];
+			TSet<uint64>& LocalEdges = ScopedEdges->Get_Ref(Scope);
+			TArray<PCGExMath::FKDTree::FNearest> Nearest;
 
-		// Partial sort to get K smallest
-		Algo::Sort(Distances, [](const auto& A, const auto& B) { return A.Key < B.Key; });
+			PCGEX_SCOPE_LOOP(i)
+			{
+				if (!CanGenerateRef[i]) { continue; }
 
-		if (bMutual)
-		{
-			for (int32 k = 0; k < ActualK; ++k) { NeighborSets[i].Add(Distances[k].Value); }
-		}
-		else
-		{
-			// Add edges to K nearest
-			for (int32 k = 0; k < ActualK; ++k) { OutEdges.Add(PCGEx::H64U(i, Distances[k].Value)); }
-		}
-	}
+				// Only points accepting connections can be picked as neighbors
+				Tree.FindKNearest(Positions[i], FMath::Min(K->Read(i), NumPoints - 1), Nearest, [&](const int32 j) { return j != i && AcceptConnectionsRef[j]; });
+				if (Nearest.IsEmpty()) { continue; }
+
+				if (bMutual)
+				{
+					TArray<int32>& PointNeighbors = Neighbors[i];
+					PointNeighbors.Reserve(Nearest.Num());
+					for (const PCGExMath::FKDTree::FNearest& N : Nearest) { PointNeighbors.Add(N.Item); }
+				}
+				else
+				{
+					for (const PCGExMath::FKDTree::FNearest& N : Nearest) { LocalEdges.Add(PCGEx::H64U(i, N.Item)); }
+				}
+			}
+		});
 
 	if (bMutual)
 	{
 		// Only add edge if mutual
-		for (int32 i = 0; i < NumPoints; ++i)
-		{
-			for (const int32 j : NeighborSets[i])
+		ParallelFor(
+			Scopes.Num(), [&](const int32 ScopeIndex)
 			{
-				if (j > i && NeighborSets[j].Contains(i))
+				const PCGExMT::FScope& Scope = Scopes[ScopeIndex];
+				TSet<uint64>& LocalEdges = ScopedEdges->Get_Ref(Scope);
+
+				PCGEX_SCOPE_LOOP(i)
 				{
-					OutEdges.Add(PCGEx::H64U(i, j));
+					for (const int32 j : Neighbors[i])
+					{
+						if (j > i && Neighbors[j].Contains(i)) { LocalEdges.Add(PCGEx::H64U(i, j)); }
+					}
 				}
-			}
-		}
+			});
 	}
+
+	ScopedEdges->Collapse(OutEdges);
 }
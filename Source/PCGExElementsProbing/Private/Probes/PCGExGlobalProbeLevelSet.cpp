@@ -3,6 +3,7 @@
 
 #include "Probes/PCGExGlobalProbeLevelSet.h"
 #include "Data/PCGExData.h"
+#include "Core/PCGExMTCommon.h"
 #include "Data/PCGExPointIO.h"
 
 PCGEX_CREATE_PROBE_FACTORY(LevelSet, {}, {})
@@ -34,11 +35,12 @@ bool FPCGExProbeLevelSet::Prepare(FPCGExContext* InContext)
 	return true;
 }
 
-void FPCGExProbeLevelSet::ProcessAll(TSet<uint64>& OutEdges) const
+bool FPCGExProbeLevelSet::SupportsScopedProcessing() const { return true; }
+
+void FPCGExProbeLevelSet::ProcessScope(const int32 Pass, const PCGExMT::FScope& Scope, TSet<uint64>& OutEdges)
 {
 	const TArray<FVector>& Positions = *WorkingPositions;
-	const int32 NumPoints = Positions.Num();
-	if (NumPoints < 2) { return; }
+	if (Positions.Num() < 2) { return; }
 
 	const TArray<int8>& CanGenerateRef = *CanGenerate;
 	const TArray<int8>& AcceptConnectionsRef = *AcceptConnections;
@@ -52,7 +54,7 @@ void FPCGExProbeLevelSet::ProcessAll(TSet<uint64>& OutEdges) const
 		return Config.bNormalizeLevels ? (Raw - LevelMin) * NormFactor : Raw;
 	};
 
-	for (int32 i = 0; i < NumPoints; ++i)
+	PCGEX_SCOPE_LOOP(i)
 	{
 		if (!CanGenerateRef[i]) { continue; }
 
@@ -3,9 +3,100 @@
 
 #include "Probes/PCGExGlobalProbeSpanner.h"
 #include "Data/PCGExPointIO.h"
+#include "Math/PCGExKDTree.h"
 
 PCGEX_CREATE_PROBE_FACTORY(Spanner, {}, {})
 
+namespace PCGExProbeSpanner
+{
+	/**
+	 * Bounded A* over the growing spanner graph.
+	 * Only answers whether To can be reached from From within Bound; any node whose
+	 * optimistic estimate exceeds the bound is never expanded, and scratch state is
+	 * reset through the touched list so a query never costs O(N).
+	 */
+	class FBoundedSearch
+	{
+		struct FOpen
+		{
+			double F = 0;
+			double G = 0;
+			int32 Node = -1;
+
+			FOpen() = default;
+
+			FOpen(const double InF, const double InG, const int32 InNode)
+				: F(InF), G(InG), Node(InNode)
+			{
+			}
+
+			FORCEINLINE bool operator<(const FOpen& Other) const { return F < Other.F; }
+		};
+
+		const TArray<FVector>& Positions;
+		const TArray<TArray<int32>>& Adjacency;
+
+		TArray<double> Dist;
+		TArray<int32> Touched;
+		TArray<FOpen> Open;
+
+	public:
+		FBoundedSearch(const TArray<FVector>& InPositions, const TArray<TArray<int32>>& InAdjacency)
+			: Positions(InPositions), Adjacency(InAdjacency)
+		{
+			Dist.Init(MAX_dbl, Positions.Num());
+		}
+
+		bool IsWithin(const int32 From, const int32 To, const double Bound)
+		{
+			if (From == To) { return true; }
+			if (Adjacency[From].IsEmpty() || Adjacency[To].IsEmpty()) { return false; }
+
+			const FVector& Target = Positions[To];
+			bool bFound = false;
+
+			Dist[From] = 0;
+			Touched.Add(From);
+			Open.HeapPush(FOpen(FVector::Dist(Positions[From], Target), 0, From));
+
+			FOpen Current;
+			while (!Open.IsEmpty())
+			{
+				Open.HeapPop(Current, EAllowShrinking::No);
+
+				if (Current.F > Bound) { break; }
+				if (Current.Node == To)
+				{
+					bFound = true;
+					break;
+				}
+
+				if (Current.G > Dist[Current.Node]) { continue; }
+
+				const FVector& Pos = Positions[Current.Node];
+				for (const int32 Neighbor : Adjacency[Current.Node])
+				{
+					const double G = Current.G + FVector::Dist(Pos, Positions[Neighbor]);
+					if (G >= Dist[Neighbor]) { continue; }
+
+					const double F = G + FVector::Dist(Positions[Neighbor], Target);
+					if (F > Bound) { continue; }
+
+					if (Dist[Neighbor] == MAX_dbl) { Touched.Add(Neighbor); }
+					Dist[Neighbor] = G;
+					Open.HeapPush(FOpen(F, G, Neighbor));
+				}
+			}
+
+			for (const int32 Node : Touched) { Dist[Node] = MAX_dbl; }
+			Touched.Reset();
+			Open.Reset();
+
+			return bFound;
+		}
+	};
+}
+
 bool FPCGExProbeSpanner::IsGlobalProbe() const { return true; }
 
 bool FPCGExProbeSpanner::Prepare(FPCGExContext* InContext)
@@ -13,95 +104,205 @@ bool FPCGExProbeSpanner::Prepare(FPCGExContext* InContext)
 	return FPCGExProbeOperation::Prepare(InContext);
 }
 
-double FPCGExProbeSpanner::GetGraphDistance(int32 From, int32 To,
-                                            const TArray<TSet<int32>>& Adjacency, const TArray<FVector>& Positions) const
+void FPCGExProbeSpanner::GetAllPairsCandidates(TArray<FEdgeCandidate>& OutCandidates) const
 {
-	if (From == To) { return 0.0; }
-
+	const TArray<FVector>& Positions = *WorkingPositions;
 	const int32 NumPoints = Positions.Num();
-	TArray<double> Dist;
-	Dist.Init(MAX_dbl, NumPoints);
-	Dist[From] = 0.0;
 
-	// Simple Dijkstra with priority queue
-	TArray<TPair<double, int32>> PQ;
-	PQ.HeapPush({0.0, From}, [](const auto& A, const auto& B) { return A.Key < B.Key; });
+	const TArray<int8>& CanGenerateRef = *CanGenerate;
+	const TArray<int8>& AcceptConnectionsRef = *AcceptConnections;
 
-	while (PQ.Num() > 0)
-	{
-		TPair<double, int32> Current;
-		PQ.HeapPop(Current, [](const auto& A, const auto& B) { return A.Key < B.Key; });
+	OutCandidates.Reserve(FMath::Min(static_cast<int64>(Config.MaxEdgeCandidates), static_cast<int64>(NumPoints) * (NumPoints - 1) / 2));
 
-		if (Current.Value == To) { return Current.Key; }
-		if (Current.Key > Dist[Current.Value]) { continue; }
+	for (int32 i = 0; i < NumPoints && OutCandidates.Num() < Config.MaxEdgeCandidates; ++i)
+	{
+		if (!CanGenerateRef[i] && !AcceptConnectionsRef[i]) { continue; }
 
-		for (const int32 Neighbor : Adjacency[Current.Value])
+		for (int32 j = i + 1; j < NumPoints && OutCandidates.Num() < Config.MaxEdgeCandidates; ++j)
 		{
-			const double EdgeDist = FVector::Dist(Positions[Current.Value], Positions[Neighbor]);
-			const double NewDist = Dist[Current.Value] + EdgeDist;
+			if (!CanGenerateRef[j] && !AcceptConnectionsRef[j]) { continue; }
+			if (!CanGenerateRef[i] && !CanGenerateRef[j]) { continue; }
 
-			if (NewDist < Dist[Neighbor])
-			{
-				Dist[Neighbor] = NewDist;
-				PQ.HeapPush({NewDist, Neighbor}, [](const auto& A, const auto& B) { return A.Key < B.Key; });
-			}
+			OutCandidates.Add({i, j, FVector::Dist(Positions[i], Positions[j])});
 		}
 	}
-
-	return MAX_dbl; // Not reachable
 }
 
-void FPCGExProbeSpanner::ProcessAll(TSet<uint64>& OutEdges) const
+void FPCGExProbeSpanner::GetWSPDCandidates(TArray<FEdgeCandidate>& OutCandidates) const
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExProbeSpanner::GetWSPDCandidates);
+
 	const TArray<FVector>& Positions = *WorkingPositions;
 	const int32 NumPoints = Positions.Num();
-	if (NumPoints < 2) { return; }
 
 	const TArray<int8>& CanGenerateRef = *CanGenerate;
 	const TArray<int8>& AcceptConnectionsRef = *AcceptConnections;
 
-	// Build sorted list of all candidate edges
-	struct FEdgeCandidate
+	// Only points that can take part in an edge go into the split tree
+	TArray<int32> Eligible;
+	TArray<FVector> EligiblePositions;
+	Eligible.Reserve(NumPoints);
+	EligiblePositions.Reserve(NumPoints);
+
+	for (int32 i = 0; i < NumPoints; ++i)
 	{
-		int32 A, B;
-		double Dist;
+		if (!CanGenerateRef[i] && !AcceptConnectionsRef[i]) { continue; }
+		Eligible.Add(i);
+		EligiblePositions.Add(Positions[i]);
+	}
+
+	if (Eligible.Num() < 2) { return; }
+
+	// A single-item leaf kd-tree is a fair split tree : median split along the longest axis
+	PCGExMath::FKDTree Tree;
+	Tree.Build(EligiblePositions, 1);
+
+	const TArray<PCGExMath::FKDTree::FNode>& Nodes = Tree.GetNodes();
+	const TArray<int32>& Items = Tree.GetItems();
+	const int32 NumNodes = Nodes.Num();
+
+	auto GetPoint = [&](const int32 Item) { return Eligible[Item]; };
+
+	// Per-node representatives; a generator is preferred so that every pair can yield a valid edge
+	TArray<int32> AnyRep;
+	TArray<int32> GenRep;
+	TArray<double> Radius;
+	AnyRep.SetNumUninitialized(NumNodes);
+	GenRep.SetNumUninitialized(NumNodes);
+	Radius.SetNumUninitialized(NumNodes);
+
+	// Children always come after their parent, walk backward to go bottom-up
+	for (int32 n = NumNodes - 1; n >= 0; --n)
+	{
+		const PCGExMath::FKDTree::FNode& Node = Nodes[n];
+		Radius[n] = Node.Bounds.GetExtent().Size();
+		AnyRep[n] = GetPoint(Items[Node.Start]);
+		GenRep[n] = INDEX_NONE;
+
+		if (Node.IsLeaf())
+		{
+			for (int32 i = Node.Start; i < Node.End; ++i)
+			{
+				if (const int32 Point = GetPoint(Items[i]); CanGenerateRef[Point])
+				{
+					GenRep[n] = Point;
+					break;
+				}
+			}
+
+			// Collocated points share a leaf, star them around the generator
+			if (GenRep[n] != INDEX_NONE)
+			{
+				for (int32 i = Node.Start; i < Node.End; ++i)
+				{
+					if (const int32 Point = GetPoint(Items[i]); Point != GenRep[n]) { OutCandidates.Add({GenRep[n], Point, 0}); }
+				}
+			}
+
+			continue;
+		}
+
+		GenRep[n] = GenRep[Node.Left] != INDEX_NONE ? GenRep[Node.Left] : GenRep[Node.Right];
+	}
+
+	// A WSPD with separation s yields a (s+4)/(s-4)-spanner; pick s so that bound is within the requested stretch
+	constexpr double MaxSeparation = 32.0;
+	const double RequiredSeparation = Config.StretchFactor > 1 ? 4 * (Config.StretchFactor + 1) / (Config.StretchFactor - 1) : MaxSeparation;
+	const double Separation = FMath::Max(Config.Separation, FMath::Min(RequiredSeparation, MaxSeparation));
+
+	auto IsWellSeparated = [&](const int32 U, const int32 V)
+	{
+		const double R = FMath::Max(Radius[U], Radius[V]);
+		return FVector::Dist(Nodes[U].Bounds.GetCenter(), Nodes[V].Bounds.GetCenter()) - 2 * R >= Separation * R;
 	};
 
-	TArray<FEdgeCandidate> Candidates;
-	Candidates.Reserve(FMath::Min(Config.MaxEdgeCandidates, NumPoints * (NumPoints - 1) / 2));
+	auto AddPair = [&](const int32 U, const int32 V)
+	{
+		int32 A = GenRep[U];
+		int32 B = AnyRep[V];
 
-	for (int32 i = 0; i < NumPoints && Candidates.Num() < Config.MaxEdgeCandidates; ++i)
+		if (A == INDEX_NONE)
+		{
+			A = GenRep[V];
+			B = AnyRep[U];
+		}
+
+		if (A == INDEX_NONE || A == B) { return; }
+		OutCandidates.Add({A, B, FVector::Dist(Positions[A], Positions[B])});
+	};
+
+	// Find well-separated pairs by recursively splitting the largest of two unseparated nodes
+	TArray<TPair<int32, int32>> Stack;
+	for (int32 n = 0; n < NumNodes; ++n)
 	{
-		if (!CanGenerateRef[i] && !AcceptConnectionsRef[i]) { continue; }
+		if (!Nodes[n].IsLeaf()) { Stack.Emplace(Nodes[n].Left, Nodes[n].Right); }
+	}
+
+	while (!Stack.IsEmpty())
+	{
+		const TPair<int32, int32> Pair = Stack.Pop(EAllowShrinking::No);
+		const int32 U = Pair.Key;
+		const int32 V = Pair.Value;
+
+		const bool bULeaf = Nodes[U].IsLeaf();
+		const bool bVLeaf = Nodes[V].IsLeaf();
 
-		for (int32 j = i + 1; j < NumPoints && Candidates.Num() < Config.MaxEdgeCandidates; ++j)
+		if ((bULeaf && bVLeaf) || IsWellSeparated(U, V))
 		{
-			if (!CanGenerateRef[j] && !AcceptConnectionsRef[j]) { continue; }
-			if (!CanGenerateRef[i] && !CanGenerateRef[j]) { continue; }
+			AddPair(U, V);
+			continue;
+		}
 
-			Candidates.Add({i, j, FVector::Dist(Positions[i], Positions[j])});
+		if (bVLeaf || (!bULeaf && Radius[U] >= Radius[V]))
+		{
+			Stack.Emplace(Nodes[U].Left, V);
+			Stack.Emplace(Nodes[U].Right, V);
+		}
+		else
+		{
+			Stack.Emplace(U, Nodes[V].Left);
+			Stack.Emplace(U, Nodes[V].Right);
 		}
 	}
+}
 
-	// Sort by distance (greedy processes shortest first)
-	Algo::Sort(Candidates, [](const FEdgeCandidate& A, const FEdgeCandidate& B) { return A.Dist < B.Dist; });
+void FPCGExProbeSpanner::ProcessAll(TSet<uint64>& OutEdges) const
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExProbeSpanner::ProcessAll);
+
+	const TArray<FVector>& Positions = *WorkingPositions;
+	const int32 NumPoints = Positions.Num();
+	if (NumPoints < 2) { return; }
+
+	TArray<FEdgeCandidate> Candidates;
+
+	if (Config.Candidates == EPCGExProbeSpannerCandidates::WSPD) { GetWSPDCandidates(Candidates); }
+	else { GetAllPairsCandidates(Candidates); }
+
+	// Sort by distance (greedy processes shortest first), ties broken on indices so results don't depend on sort stability
+	Algo::Sort(
+		Candidates, [](const FEdgeCandidate& A, const FEdgeCandidate& B)
+		{
+			if (A.Dist != B.Dist) { return A.Dist < B.Dist; }
+			const uint64 HA = PCGEx::H64U(A.A, A.B);
+			const uint64 HB = PCGEx::H64U(B.A, B.B);
+			return HA < HB;
+		});
 
 	// Build adjacency list for path queries
-	TArray<TSet<int32>> Adjacency;
+	TArray<TArray<int32>> Adjacency;
 	Adjacency.SetNum(NumPoints);
 
+	PCGExProbeSpanner::FBoundedSearch Search(Positions, Adjacency);
+
 	// Greedy spanner construction
 	for (const FEdgeCandidate& Edge : Candidates)
 	{
-		// Check if current graph distance exceeds t * Euclidean distance
-		const double GraphDist = GetGraphDistance(Edge.A, Edge.B, Adjacency, Positions);
+		// Only add the edge if the current graph can't reach B within t * Euclidean distance
+		if (Search.IsWithin(Edge.A, Edge.B, Config.StretchFactor * Edge.Dist)) { continue; }
 
-		if (GraphDist > Config.StretchFactor * Edge.Dist)
-		{
-			// Add edge
-			OutEdges.Add(PCGEx::H64U(Edge.A, Edge.B));
-			Adjacency[Edge.A].Add(Edge.B);
-			Adjacency[Edge.B].Add(Edge.A);
-		}
+		OutEdges.Add(PCGEx::H64U(Edge.A, Edge.B));
+		Adjacency[Edge.A].Add(Edge.B);
+		Adjacency[Edge.B].Add(Edge.A);
 	}
 }
@@ -2,6 +2,7 @@
 // Released under the MIT license https://opensource.org/license/MIT/
 
 #include "Probes/PCGExGlobalProbeTheta.h"
+#include "Core/PCGExMTCommon.h"
 #include "Data/PCGExPointIO.h"
 
 PCGEX_CREATE_PROBE_FACTORY(Theta, {}, {})
@@ -30,18 +31,19 @@ bool FPCGExProbeTheta::Prepare(FPCGExContext* InContext)
 	return true;
 }
 
-void FPCGExProbeTheta::ProcessAll(TSet<uint64>& OutEdges) const
+bool FPCGExProbeTheta::SupportsScopedProcessing() const { return true; }
+
+void FPCGExProbeTheta::ProcessScope(const int32 Pass, const PCGExMT::FScope& Scope, TSet<uint64>& OutEdges)
 {
 	const TArray<FVector>& Positions = *WorkingPositions;
-	const int32 NumPoints = Positions.Num();
-	if (NumPoints < 2) { return; }
+	if (Positions.Num() < 2) { return; }
 
 	const TArray<int8>& CanGenerateRef = *CanGenerate;
 	const TArray<int8>& AcceptConnectionsRef = *AcceptConnections;
 
 	const float CosConeHalf = FMath::Cos(ConeHalfAngle);
 
-	for (int32 i = 0; i < NumPoints; ++i)
+	PCGEX_SCOPE_LOOP(i)
 	{
 		if (!CanGenerateRef[i]) { continue; }
 
@@ -15,7 +15,11 @@
 
 namespace PCGExMT
 {
+	struct FScope;
 	class FScopedContainer;
+
+	template <typename T>
+	class TScopedSet;
 }
 
 namespace PCGExData
@@ -89,6 +93,19 @@ public:
 
 	virtual void ProcessAll(TSet<uint64>& OutEdges) const;
 
+	/**
+	 * Scoped global processing, used in place of ProcessAll when supported.
+	 * PrepareScopedProcessing is called once, then each pass runs ProcessScope over every point scope in parallel,
+	 * passes running one after another. Edges are gathered per-scope and merged by CompleteScopedProcessing.
+	 */
+	virtual bool SupportsScopedProcessing() const;
+	virtual int32 GetNumScopedPasses() const;
+	virtual void PrepareScopedProcessing(const TArray<PCGExMT::FScope>& Loops);
+	virtual void ProcessScope(const int32 Pass, const PCGExMT::FScope& Scope, TSet<uint64>& OutEdges);
+	virtual void CompleteScopedProcessing(TSet<uint64>& OutEdges);
+
+	TSet<uint64>& GetScopedEdges(const PCGExMT::FScope& Scope) const;
+
 	FPCGExProbeConfigBase* BaseConfig = nullptr;
 	const PCGExOctree::FItemOctree* Octree = nullptr;
 	const TArray<FTransform>* WorkingTransforms = nullptr;
@@ -103,4 +120,5 @@ public:
 protected:
 	TSharedPtr<PCGExData::FPointIO> PointIO;
 	TArray<double> LocalWeightMultiplier;
+	TSharedPtr<PCGExMT::TScopedSet<uint64>> ScopedEdges;
 };
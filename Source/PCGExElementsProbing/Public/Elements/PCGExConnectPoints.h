@@ -110,6 +110,7 @@ namespace PCGExConnectPoints
 		TArray<FPCGExProbeOperation*> ChainedOperations;
 		TArray<FPCGExProbeOperation*> SharedOperations;
 		TArray<FPCGExProbeOperation*> GlobalOperations;
+		TArray<FPCGExProbeOperation*> ScopedGlobalOperations;
 
 		int32 NumRadiusSources = 0;
 		int32 NumDirectOps = 0;
@@ -158,6 +159,8 @@ namespace PCGExConnectPoints
 		virtual void ProcessPoints(const PCGExMT::FScope& Scope) override;
 		virtual void OnPointsProcessingComplete() override;
 
+		void ProcessScopedGlobalOperation(FPCGExProbeOperation* Operation, const int32 Pass);
+
 		void AdvanceCompletion();
 
 		virtual void CompleteWork() override;
@@ -38,9 +38,17 @@ public:
 	virtual bool IsGlobalProbe() const override;
 	virtual bool WantsOctree() const override;
 	virtual bool Prepare(FPCGExContext* InContext) override;
-	virtual void ProcessAll(TSet<uint64>& OutEdges) const override;
+	virtual bool SupportsScopedProcessing() const override;
+	virtual int32 GetNumScopedPasses() const override;
+	virtual void PrepareScopedProcessing(const TArray<PCGExMT::FScope>& Loops) override;
+	virtual void ProcessScope(const int32 Pass, const PCGExMT::FScope& Scope, TSet<uint64>& OutEdges) override;
+	virtual void CompleteScopedProcessing(TSet<uint64>& OutEdges) override;
 
 	FPCGExProbeConfigDBSCAN Config;
+
+protected:
+	TArray<TArray<int32>> Neighborhoods;
+	TArray<bool> IsCore;
 };
 
 // Factory classes...
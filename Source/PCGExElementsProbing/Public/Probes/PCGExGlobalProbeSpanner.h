@@ -9,6 +9,13 @@
 
 #include "PCGExGlobalProbeSpanner.generated.h"
 
+UENUM()
+enum class EPCGExProbeSpannerCandidates : uint8
+{
+	AllPairs = 0 UMETA(DisplayName = "All Pairs", ToolTip="Every pair of points is a candidate, up to Max Edge Candidates. Quadratic."),
+	WSPD     = 1 UMETA(DisplayName = "WSPD", ToolTip="Candidates are drawn from a well-separated pair decomposition. O(N log N) candidates, no cap."),
+};
+
 USTRUCT(BlueprintType)
 struct FPCGExProbeConfigSpanner : public FPCGExProbeConfigBase
 {
@@ -23,9 +30,21 @@ struct FPCGExProbeConfigSpanner : public FPCGExProbeConfigBase
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Settings, meta=(PCG_Overridable, ClampMin="1.0", ClampMax="10.0"))
 	double StretchFactor = 2.0;
 
+	/** How candidate edges are generated before the greedy pass. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Settings, meta=(PCG_Overridable))
+	EPCGExProbeSpannerCandidates Candidates = EPCGExProbeSpannerCandidates::AllPairs;
+
 	/** Max edges to consider (performance limit) */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Settings, meta=(PCG_Overridable, ClampMin="100"))
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Settings, meta=(PCG_Overridable, ClampMin="100", EditCondition="Candidates == EPCGExProbeSpannerCandidates::AllPairs", EditConditionHides))
 	int32 MaxEdgeCandidates = 50000;
+
+	/**
+	 * Minimum WSPD separation factor. It is raised to 4(t+1)/(t-1), t being the Stretch Factor, so the candidates alone form a t-spanner;
+	 * the greedy pass then only drops candidates that already have a path within t. That requirement is capped at 32, so below a stretch of ~1.29
+	 * the candidates no longer guarantee t. Higher values yield more, finer candidates and a result closer to the all-pairs greedy spanner.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Settings, meta=(PCG_Overridable, ClampMin="1.0", ClampMax="32.0", EditCondition="Candidates == EPCGExProbeSpannerCandidates::WSPD", EditConditionHides))
+	double Separation = 4.0;
 };
 
 class FPCGExProbeSpanner : public FPCGExProbeOperation
@@ -38,9 +57,15 @@ public:
 	FPCGExProbeConfigSpanner Config;
 
 protected:
-	// Dijkstra helper - returns shortest path distance between two nodes in current graph
-	double GetGraphDistance(int32 From, int32 To, const TArray<TSet<int32>>& Adjacency,
-	                        const TArray<FVector>& Positions) const;
+	struct FEdgeCandidate
+	{
+		int32 A = -1;
+		int32 B = -1;
+		double Dist = 0;
+	};
+
+	void GetAllPairsCandidates(TArray<FEdgeCandidate>& OutCandidates) const;
+	void GetWSPDCandidates(TArray<FEdgeCandidate>& OutCandidates) const;
 };
 
 // Factory classes...
@@ -100,6 +100,18 @@ bool FPCGExSampleNearestPointElement::Boot(FPCGExContext* InContext) const
 
 	Context->TargetsHandler->SetDistances(Settings->DistanceDetails);
 
+	// Unbounded closest-target queries can be answered by a single kd-tree over all targets
+	// as long as distances are plain center-to-center and weighting doesn't alter the ranking.
+	Context->bUseTargetsIndex =
+		Settings->SampleMethod == EPCGExSampleMethod::ClosestTarget &&
+		Settings->WeightMode == EPCGExSampleWeightMode::Distance &&
+		Settings->DistanceDetails.Source == EPCGExDistance::Center &&
+		Settings->DistanceDetails.Target == EPCGExDistance::Center &&
+		Settings->DistanceDetails.Type == EPCGExDistanceType::Euclidian &&
+		(Settings->RangeMaxInput != EPCGExInputValueType::Constant || Settings->RangeMax <= 0);
+
+	if (Context->bUseTargetsIndex) { Context->TargetsHandler->BuildPointsIndex(); }
+
 	if (Settings->SampleMethod == EPCGExSampleMethod::BestCandidate)
 	{
 		Context->Sorter = MakeShared<PCGExSorting::FSorter>(PCGExSorting::GetSortingRules(Context, PCGExSorting::Labels::SourceSortingRules));
@@ -338,6 +350,10 @@ namespace PCGExSampleNearestPoint
 
 		const TSharedPtr<PCGExSampling::FSampingUnionData> Union = MakeShared<PCGExSampling::FSampingUnionData>();
 
+		// Ignore list is fixed for the whole processor, resolve it once per scope rather than once per indexed query
+		TBitArray<> ExcludedTargets;
+		if (Context->bUseTargetsIndex) { Context->TargetsHandler->GetExcludedTargets(&IgnoreList, ExcludedTargets); }
+
 		const bool bProcessFilteredOutAsFails = Settings->bProcessFilteredOutAsFails;
 		const double DefaultDet = Settings->SampleMethod == EPCGExSampleMethod::ClosestTarget ? MAX_dbl : MIN_dbl;
 
@@ -406,6 +422,11 @@ namespace PCGExSampleNearestPoint
 				if (bSingleSample) { Context->TargetsHandler->FindElementsWithBoundsTest(Box, SampleSingleTarget, &IgnoreList); }
 				else { Context->TargetsHandler->FindElementsWithBoundsTest(Box, SampleMultiTarget, &IgnoreList); }
 			}
+			else if (Context->bUseTargetsIndex)
+			{
+				PCGExData::FConstPoint Nearest;
+				if (double NearestDistSquared = MAX_dbl; Context->TargetsHandler->FindNearestIndexed(Origin, Nearest, NearestDistSquared, ExcludedTargets)) { SampleSingleTarget(Nearest); }
+			}
 			else
 			{
 				if (bSingleSample) { Context->TargetsHandler->ForEachTargetPoint(SampleSingleTarget, &IgnoreList); }
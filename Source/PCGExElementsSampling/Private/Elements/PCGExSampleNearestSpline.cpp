@@ -3,12 +3,14 @@
 
 #include "Elements/PCGExSampleNearestSpline.h"
 
+#include "Async/ParallelFor.h"
 #include "Containers/PCGExScopedContainers.h"
 #include "Data/PCGExData.h"
 #include "Data/PCGExDataTags.h"
 #include "Data/PCGExPointIO.h"
 #include "Details/PCGExSettingsDetails.h"
 #include "Math/PCGExMathDistances.h"
+#include "Paths/PCGExSplineProjection.h"
 #include "Sampling/PCGExSamplingHelpers.h"
 #include "Types/PCGExTypes.h"
 
@@ -128,6 +130,13 @@ bool FPCGExSampleNearestSplineElement::Boot(FPCGExContext* InContext) const
 		}
 	}
 
+	if (Settings->bPrecomputeProjection && !Settings->bSampleSpecificAlpha)
+	{
+		const int32 SamplesPerSegment = Settings->ProjectionSamplesPerSegment;
+		Context->Projections.SetNum(Context->NumTargets);
+		ParallelFor(Context->NumTargets, [&](const int32 i) { Context->Projections[i] = MakeShared<PCGExPaths::FSplineProjection>(Context->Splines[i], SamplesPerSegment); });
+	}
+
 	if (Settings->bUseOctree)
 	{
 		Context->SplineOctree = MakeShared<PCGExOctree::FItemOctree>(Context->OctreeBounds.GetCenter(), Context->OctreeBounds.GetExtent().Length());
@@ -421,7 +430,7 @@ namespace PCGExSampleNearestSpline
 				auto ProcessClosestAlpha = [&](const int32 TargetIndex)
 				{
 					const FPCGSplineStruct& Line = Context->Splines[TargetIndex];
-					const double Time = Line.FindInputKeyClosestToWorldLocation(Origin);
+					const double Time = Context->Projections.IsEmpty() ? Line.FindInputKeyClosestToWorldLocation(Origin) : Context->Projections[TargetIndex]->FindInputKeyClosestToWorldLocation(Origin);
 					ProcessTarget(Line.GetTransformAtSplineInputKey
 					              (static_cast<float>(Time), ESplineCoordinateSpace::World, Settings->bSplineScalesRanges),
 					              Time, Context->SegmentCounts[TargetIndex], Line);
@@ -131,7 +131,7 @@ namespace PCGExSelfPruning
 			{
 				if (TSharedPtr<PCGExSorting::FSortCache> Cache = Sorter->BuildCache(NumPoints))
 				{
-					Order.Sort([&](const int32 A, const int32 B) { return Cache->Compare(A, B); });
+					Cache->Sort(Order);
 				}
 				else
 				{
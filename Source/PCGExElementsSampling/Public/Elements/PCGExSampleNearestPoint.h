@@ -352,6 +352,7 @@ struct FPCGExSampleNearestPointContext final : FPCGExPointsProcessorContext
 
 	TSharedPtr<PCGExMatching::FTargetsHandler> TargetsHandler;
 	int32 NumMaxTargets = 0;
+	bool bUseTargetsIndex = false;
 
 	TArray<TSharedPtr<PCGExData::TBuffer<double>>> TargetWeights;
 	TArray<TSharedPtr<PCGExDetails::TSettingValue<FVector>>> TargetLookAtUpGetters;
@@ -46,6 +46,11 @@ namespace PCGExMT
 	class TScopedNumericValue;
 }
 
+namespace PCGExPaths
+{
+	class FSplineProjection;
+}
+
 UENUM()
 enum class EPCGExSplineDepthMode : uint8
 {
@@ -455,6 +460,15 @@ public:
 	/** Optimize spatial partitioning, but limit the "reach" of splines to their bounding box. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable), AdvancedDisplay)
 	bool bUseOctree = true;
+
+	/** Precompute a dense segment hierarchy for each spline, shared by all points, instead of refining the closest input key against every spline segment for every point.
+	 * Faster on large inputs, but projections are approximate and may differ slightly from the default per-point refinement. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_NotOverridable), AdvancedDisplay)
+	bool bPrecomputeProjection = false;
+
+	/** Number of polyline samples per spline segment used by the precomputed projection. Higher values are more accurate on tight curves. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_NotOverridable, DisplayName=" └─ Samples per Segment", EditCondition="bPrecomputeProjection", ClampMin=1), AdvancedDisplay)
+	int32 ProjectionSamplesPerSegment = 16;
 };
 
 struct FPCGExSampleNearestSplineContext final : FPCGExPointsProcessorContext
@@ -467,6 +481,7 @@ struct FPCGExSampleNearestSplineContext final : FPCGExPointsProcessorContext
 	TArray<FPCGSplineStruct> Splines;
 	TArray<double> SegmentCounts;
 	TArray<double> Lengths;
+	TArray<TSharedPtr<PCGExPaths::FSplineProjection>> Projections;
 
 	FBox OctreeBounds = FBox(ForceInit);
 	TSharedPtr<PCGExOctree::FItemOctree> SplineOctree;
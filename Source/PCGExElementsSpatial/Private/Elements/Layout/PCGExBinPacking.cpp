@@ -335,7 +335,7 @@ namespace PCGExBinPacking
 		{
 			if (TSharedPtr<PCGExSorting::FSortCache> Cache = Sorter->BuildCache(NumPoints))
 			{
-				ProcessingOrder.Sort([&](const int32 A, const int32 B) { return Cache->Compare(A, B); });
+				Cache->Sort(ProcessingOrder);
 			}
 			else
 			{
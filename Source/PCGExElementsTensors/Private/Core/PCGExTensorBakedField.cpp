@@ -0,0 +1,156 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Core/PCGExTensorBakedField.h"
+
+namespace PCGExTensor
+{
+	namespace BakedField
+	{
+		// Keep a node of margin so X0 + 1 can't overflow
+		constexpr double MaxGridCoordinate = static_cast<double>(MAX_int32 - 1);
+
+		FORCEINLINE static int32 GetLocalIndex(const int32 X, const int32 Y, const int32 Z)
+		{
+			return X + (Y << FBakedField::BrickShift) + (Z << (FBakedField::BrickShift * 2));
+		}
+	}
+
+	FBakedField::FBakedField(const FVector& InOrigin, const double InCellSize, FEvaluator&& InEvaluator)
+		: Evaluator(MoveTemp(InEvaluator)), Origin(InOrigin), CellSize(FMath::Max(InCellSize, UE_KINDA_SMALL_NUMBER)), InvCellSize(1.0 / CellSize)
+	{
+	}
+
+	FTensorSample FBakedField::Sample(const FVector& InPosition) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FBakedField::Sample);
+
+		const FVector GridPosition = (InPosition - Origin) * InvCellSize;
+
+		if (GridPosition.GetAbsMax() >= BakedField::MaxGridCoordinate || GridPosition.ContainsNaN())
+		{
+			// Outside of what node coordinates can address
+			return Evaluator(InPosition);
+		}
+
+		const int32 X0 = FMath::FloorToInt32(GridPosition.X);
+		const int32 Y0 = FMath::FloorToInt32(GridPosition.Y);
+		const int32 Z0 = FMath::FloorToInt32(GridPosition.Z);
+
+		const FVector Alpha = GridPosition - FVector(X0, Y0, Z0);
+
+		FVector DirectionAndSize = FVector::ZeroVector;
+		FQuat Rotation = FQuat(0, 0, 0, 0);
+		FQuat Reference = FQuat::Identity;
+		bool bHasReference = false;
+		double Weight = 0;
+		int32 Effectors = 0;
+
+		FIntVector CachedBrick = FIntVector(MAX_int32);
+		const FBrick* Brick = nullptr;
+
+		for (int32 i = 0; i < 8; i++)
+		{
+			const int32 DX = i & 1;
+			const int32 DY = (i >> 1) & 1;
+			const int32 DZ = (i >> 2) & 1;
+
+			const double W =
+				(DX ? Alpha.X : 1 - Alpha.X) *
+				(DY ? Alpha.Y : 1 - Alpha.Y) *
+				(DZ ? Alpha.Z : 1 - Alpha.Z);
+
+			if (W <= 0) { continue; }
+
+			const FIntVector Node = FIntVector(X0 + DX, Y0 + DY, Z0 + DZ);
+			const FIntVector NodeBrick = FIntVector(Node.X >> BrickShift, Node.Y >> BrickShift, Node.Z >> BrickShift);
+
+			if (NodeBrick != CachedBrick)
+			{
+				Brick = GetBrick(NodeBrick);
+				CachedBrick = NodeBrick;
+			}
+
+			const FTensorSample& NodeSample = Brick->Nodes[BakedField::GetLocalIndex(Node.X & BrickMask, Node.Y & BrickMask, Node.Z & BrickMask)];
+
+			// Empty nodes still pull the interpolated field toward zero
+			DirectionAndSize += NodeSample.DirectionAndSize * W;
+			Weight += NodeSample.Weight * W;
+
+			if (NodeSample.Effectors == 0) { continue; }
+
+			Effectors = FMath::Max(Effectors, NodeSample.Effectors);
+
+			// Keep rotations in the same hemisphere so the weighted sum doesn't cancel out
+			if (!bHasReference)
+			{
+				Reference = NodeSample.Rotation;
+				bHasReference = true;
+			}
+
+			Rotation += (Reference | NodeSample.Rotation) < 0 ? NodeSample.Rotation * -W : NodeSample.Rotation * W;
+		}
+
+		if (!Effectors) { return FTensorSample(); }
+
+		return FTensorSample(DirectionAndSize, Rotation.GetNormalized(), Effectors, Weight);
+	}
+
+	int32 FBakedField::GetNumBricks() const
+	{
+		FReadScopeLock ReadScopeLock(BricksLock);
+		return Bricks.Num();
+	}
+
+	const FBakedField::FBrick* FBakedField::GetBrick(const FIntVector& InBrick) const
+	{
+		FBrick* Brick = nullptr;
+
+		{
+			FReadScopeLock ReadScopeLock(BricksLock);
+			if (const TSharedPtr<FBrick>* Existing = Bricks.Find(InBrick)) { Brick = Existing->Get(); }
+		}
+
+		if (!Brick)
+		{
+			FWriteScopeLock WriteScopeLock(BricksLock);
+			TSharedPtr<FBrick>& NewBrick = Bricks.FindOrAdd(InBrick);
+			if (!NewBrick) { NewBrick = MakeShared<FBrick>(); }
+			Brick = NewBrick.Get();
+		}
+
+		if (!Brick->bFilled.load(std::memory_order_acquire))
+		{
+			// Only lock the brick being filled, so others remain available meanwhile
+			FScopeLock Lock(&Brick->Lock);
+			if (!Brick->bFilled.load(std::memory_order_relaxed))
+			{
+				FillBrick(InBrick, *Brick);
+				Brick->bFilled.store(true, std::memory_order_release);
+			}
+		}
+
+		return Brick;
+	}
+
+	void FBakedField::FillBrick(const FIntVector& InBrick, FBrick& InOutBrick) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FBakedField::FillBrick);
+
+		InOutBrick.Nodes.SetNum(BrickSize * BrickSize * BrickSize);
+
+		const FIntVector First = FIntVector(InBrick.X << BrickShift, InBrick.Y << BrickShift, InBrick.Z << BrickShift);
+
+		for (int32 Z = 0; Z < BrickSize; Z++)
+		{
+			for (int32 Y = 0; Y < BrickSize; Y++)
+			{
+				for (int32 X = 0; X < BrickSize; X++)
+				{
+					const FVector Location = Origin + FVector(First.X + X, First.Y + Y, First.Z + Z) * CellSize;
+					InOutBrick.Nodes[BakedField::GetLocalIndex(X, Y, Z)] = Evaluator(Location);
+				}
+			}
+		}
+	}
+}
@@ -4,8 +4,11 @@
 #include "Core/PCGExTensorHandler.h"
 
 #include "Containers/PCGExManagedObjects.h"
+#include "Core/PCGExTensorBakedField.h"
 #include "Core/PCGExTensorFactoryProvider.h"
 #include "Core/PCGExTensorOperation.h"
+#include "Data/PCGBasePointData.h"
+#include "Data/PCGExData.h"
 #include "UObject/UObjectGlobals.h"
 #include "UObject/Package.h"
 
@@ -55,6 +58,34 @@ namespace PCGExTensor
 		SamplerInstance->ErrorTolerance = Config.SamplerSettings.ErrorTolerance;
 		SamplerInstance->MaxSubSteps = Config.SamplerSettings.MaxSubSteps;
 
+		if (Config.bBakeField && !Tensors.IsEmpty())
+		{
+			bool bCanBake = true;
+			for (const TSharedPtr<PCGExTensorOperation>& Op : Tensors)
+			{
+				if (!Op->IsPositionOnly())
+				{
+					bCanBake = false;
+					break;
+				}
+			}
+
+			if (bCanBake)
+			{
+				const FVector Origin = InDataFacade ? InDataFacade->GetIn()->GetBounds().Min : FVector::ZeroVector;
+				SamplerInstance->BakedField = MakeShared<FBakedField>(
+					Origin, Config.BakeCellSize,
+					[BakedTensors = Tensors](const FVector& InLocation)
+					{
+						return UPCGExTensorSampler::SampleTensors(BakedTensors, 0, FTransform(InLocation));
+					});
+			}
+			else
+			{
+				PCGE_LOG_C(Warning, GraphAndLog, InContext, FTEXT("Some tensors depend on seeds or probe orientation and cannot be baked, sampling them directly instead."));
+			}
+		}
+
 		return SamplerInstance->PrepareForData(InContext);
 	}
 
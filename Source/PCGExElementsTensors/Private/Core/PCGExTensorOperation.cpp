@@ -18,6 +18,12 @@ PCGExTensor::FTensorSample PCGExTensorOperation::Sample(const int32 InSeedIndex,
 	return PCGExTensor::FTensorSample{};
 }
 
+bool PCGExTensorOperation::IsPositionOnly() const
+{
+	// Bidirectional mutation reads the probe orientation
+	return !BaseConfig.Mutations.bBidirectional;
+}
+
 bool PCGExTensorOperation::PrepareForData(const TSharedPtr<PCGExData::FFacade>& InDataFacade)
 {
 	PrimaryDataFacade = InDataFacade;
@@ -4,6 +4,7 @@
 
 #include "Core/PCGExTensorSampler.h"
 
+#include "Core/PCGExTensorBakedField.h"
 #include "Core/PCGExTensorOperation.h"
 
 
@@ -25,6 +26,15 @@ PCGExTensor::FTensorSample UPCGExTensorSampler::RawSample(
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(UPCGExTensorSampler::RawSample);
 
+	if (BakedField) { return BakedField->Sample(InProbe.GetLocation()); }
+	return SampleTensors(InTensors, InSeedIndex, InProbe);
+}
+
+PCGExTensor::FTensorSample UPCGExTensorSampler::SampleTensors(
+	const TArray<TSharedPtr<PCGExTensorOperation>>& InTensors,
+	const int32 InSeedIndex,
+	const FTransform& InProbe)
+{
 	// First pass: collect samples and total weight
 	TArray<PCGExTensor::FTensorSample, TInlineAllocator<8>> Samples;
 	Samples.Reserve(InTensors.Num());
@@ -321,6 +321,13 @@ FVector FPCGExTensorSurface::ComputeDirection(const FTransform& InProbe, const F
 	}
 }
 
+bool FPCGExTensorSurface::IsPositionOnly() const
+{
+	// These modes project the probe' reference axis
+	if (Config.Mode == EPCGExSurfaceTensorMode::AlongSurface || Config.Mode == EPCGExSurfaceTensorMode::Orbit) { return false; }
+	return PCGExTensorOperation::IsPositionOnly();
+}
+
 // Factory implementation
 
 PCGEX_TENSOR_BOILERPLATE(Surface, {}, {})
@@ -0,0 +1,61 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include <atomic>
+
+#include "CoreMinimal.h"
+#include "Core/PCGExTensor.h"
+
+namespace PCGExTensor
+{
+	/**
+	 * Combined tensor field rasterized on a sparse grid of nodes.
+	 * Nodes are grouped in cubic bricks that are only evaluated the first time a sample falls into them,
+	 * samples are then trilinearly interpolated from the eight surrounding nodes.
+	 * Thread-safe.
+	 */
+	class PCGEXELEMENTSTENSORS_API FBakedField : public TSharedFromThis<FBakedField>
+	{
+	public:
+		using FEvaluator = TFunction<FTensorSample(const FVector&)>;
+
+		static constexpr int32 BrickShift = 3;
+		static constexpr int32 BrickSize = 1 << BrickShift;
+		static constexpr int32 BrickMask = BrickSize - 1;
+
+	protected:
+		struct FBrick
+		{
+			FCriticalSection Lock;
+			std::atomic<bool> bFilled{false};
+			TArray<FTensorSample> Nodes;
+		};
+
+		FEvaluator Evaluator;
+
+		FVector Origin = FVector::ZeroVector;
+		double CellSize = 1;
+		double InvCellSize = 1;
+
+		mutable FRWLock BricksLock;
+		mutable TMap<FIntVector, TSharedPtr<FBrick>> Bricks;
+
+	public:
+		/**
+		 * @param InOrigin Location of the node (0,0,0), grid extends from there as far as int32 node coordinates allow; samples beyond are evaluated directly
+		 * @param InCellSize Distance between two nodes
+		 * @param InEvaluator Evaluates the unbaked field at a given location
+		 */
+		FBakedField(const FVector& InOrigin, const double InCellSize, FEvaluator&& InEvaluator);
+
+		FTensorSample Sample(const FVector& InPosition) const;
+
+		int32 GetNumBricks() const;
+
+	protected:
+		const FBrick* GetBrick(const FIntVector& InBrick) const;
+		void FillBrick(const FIntVector& InBrick, FBrick& InOutBrick) const;
+	};
+}
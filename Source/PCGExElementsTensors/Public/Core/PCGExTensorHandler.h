@@ -102,6 +102,16 @@ struct PCGEXELEMENTSTENSORS_API FPCGExTensorHandlerDetails
 	/** Uniform scale factor applied to sampling after all other mutations are accounted for. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
 	FPCGExTensorSamplerDetails SamplerSettings;
+
+	/** If enabled, the combined tensor field is baked into a sparse grid anchored on the seeds' bounds, filled lazily as it is sampled, and trilinearly interpolated afterward.
+	 * Much faster when sampling the same area over and over (i.e long extrusions from many seeds), at the cost of precision.
+	 * NOTE : Ignored if any tensor depends on the seed or the probe orientation (Inertia, Bidirectional mutations, etc.) */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_NotOverridable))
+	bool bBakeField = false;
+
+	/** Distance between two nodes of the baked grid. Smaller values are more precise but slower to bake. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable, DisplayName = " └─ Cell Size", EditCondition="bBakeField", EditConditionHides, ClampMin=0.1))
+	double BakeCellSize = 50;
 };
 
 namespace PCGExTensor
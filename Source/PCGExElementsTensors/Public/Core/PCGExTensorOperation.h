@@ -38,6 +38,9 @@ public:
 
 	virtual PCGExTensor::FTensorSample Sample(int32 InSeedIndex, const FTransform& InProbe) const;
 
+	/** Whether samples only depend on the probe location, i.e neither on the seed nor on the probe orientation. Required for baking. */
+	virtual bool IsPositionOnly() const;
+
 	virtual bool PrepareForData(const TSharedPtr<PCGExData::FFacade>& InDataFacade);
 
 	template <bool bFast = false>
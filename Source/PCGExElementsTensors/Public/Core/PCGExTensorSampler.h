@@ -10,6 +10,12 @@
 #include "PCGExTensorSampler.generated.h"
 
 class PCGExTensorOperation;
+
+namespace PCGExTensor
+{
+	class FBakedField;
+}
+
 /**
  * 
  */
@@ -38,8 +44,14 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, ClampMin=1, ClampMax=16))
 	int32 MaxSubSteps = 4;
 
+	/** If set, raw samples are interpolated from this baked field instead of evaluating tensors */
+	TSharedPtr<PCGExTensor::FBakedField> BakedField;
+
 	virtual void CopySettingsFrom(const UPCGExInstancedFactory* Other) override;
 	virtual bool PrepareForData(FPCGExContext* InContext);
 	virtual PCGExTensor::FTensorSample RawSample(const TArray<TSharedPtr<PCGExTensorOperation>>& InTensors, int32 InSeedIndex, const FTransform& InProbe) const;
 	virtual PCGExTensor::FTensorSample Sample(const TArray<TSharedPtr<PCGExTensorOperation>>& InTensors, int32 InSeedIndex, const FTransform& InProbe, bool& OutSuccess) const;
+
+	/** Weighted blend of all tensors sampled at the given probe, bypassing any baked field */
+	static PCGExTensor::FTensorSample SampleTensors(const TArray<TSharedPtr<PCGExTensorOperation>>& InTensors, int32 InSeedIndex, const FTransform& InProbe);
 };
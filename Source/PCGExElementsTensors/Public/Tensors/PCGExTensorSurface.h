@@ -119,6 +119,7 @@ public:
 
 	virtual bool Init(FPCGExContext* InContext, const UPCGExTensorFactoryData* InFactory) override;
 	virtual PCGExTensor::FTensorSample Sample(int32 InSeedIndex, const FTransform& InProbe) const override;
+	virtual bool IsPositionOnly() const override;
 
 protected:
 	/** Find the nearest surface across all available sources */
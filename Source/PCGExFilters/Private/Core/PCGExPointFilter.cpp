@@ -4,8 +4,12 @@
 #include "Core/PCGExPointFilter.h"
 
 #include "PCGExFiltersSubSystem.h"
+#include "PCGExLog.h"
+#include "PCGExSettingsCacheBody.h"
+#include "PCGExCoreSettingsCache.h"
 #include "Data/PCGExData.h"
 #include "Data/PCGExPointIO.h"
+#include "Helpers/PCGExArrayHelpers.h"
 #include "Clusters/PCGExCluster.h"
 #include "Async/ParallelFor.h"
 
@@ -63,6 +67,11 @@ namespace PCGExPointFilter
 
 	bool IFilter::Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const { return bCollectionTestResult; }
 
+	void IFilter::TestScope(const PCGExMT::FScope& Scope, TArrayView<int8> OutResults) const
+	{
+		for (int i = 0; i < Scope.Count; i++) { if (OutResults[i]) { OutResults[i] = Test(Scope.Start + i); } }
+	}
+
 	bool ISimpleFilter::Test(const int32 Index) const PCGEX_NOT_IMPLEMENTED_RET(FSimpleFilter::Test(const PCGExClusters::FNode& Node), false)
 
 	bool ISimpleFilter::Test(const PCGExData::FProxyPoint& Point) const PCGEX_NOT_IMPLEMENTED_RET(FSimpleFilter::TestRoamingPoint(const PCGExClusters::PCGExData::FProxyPoint& Point), false)
@@ -87,9 +96,15 @@ namespace PCGExPointFilter
 
 	bool ICollectionFilter::Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const PCGEX_NOT_IMPLEMENTED_RET(FCollectionFilter::Test(FPCGExContext* InContext, const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection), false)
 
+	void ICollectionFilter::TestScope(const PCGExMT::FScope& Scope, TArrayView<int8> OutResults) const
+	{
+		if (!bCollectionTestResult) { FMemory::Memzero(OutResults.GetData(), OutResults.Num() * sizeof(int8)); }
+	}
+
 	FManager::FManager(const TSharedRef<PCGExData::FFacade>& InPointDataFacade)
 		: PointDataFacade(InPointDataFacade)
 	{
+		bAdaptiveOrdering = PCGEX_CORE_SETTINGS.bAdaptiveFilterOrdering;
 	}
 
 	bool FManager::Init(FPCGExContext* InContext, const TArray<TObjectPtr<const UPCGExPointFilterFactoryData>>& InFactories)
@@ -174,40 +189,69 @@ namespace PCGExPointFilter
 
 	bool FManager::Test(const int32 Index)
 	{
-		for (const IFilter* Filter : Stack) { if (!Filter->Test(Index)) { return false; } }
+		for (const IFilter* Filter : GetActiveStack()) { if (!Filter->Test(Index)) { return false; } }
 		return true;
 	}
 
 	bool FManager::Test(const PCGExData::FProxyPoint& Point)
 	{
-		for (const IFilter* Filter : Stack) { if (!Filter->Test(Point)) { return false; } }
+		for (const IFilter* Filter : GetActiveStack()) { if (!Filter->Test(Point)) { return false; } }
 		return true;
 	}
 
 	bool FManager::Test(const PCGExClusters::FNode& Node)
 	{
-		for (const IFilter* Filter : Stack) { if (!Filter->Test(Node)) { return false; } }
+		for (const IFilter* Filter : GetActiveStack()) { if (!Filter->Test(Node)) { return false; } }
 		return true;
 	}
 
 	bool FManager::Test(const PCGExGraphs::FEdge& Edge)
 	{
-		for (const IFilter* Filter : Stack) { if (!Filter->Test(Edge)) { return false; } }
+		for (const IFilter* Filter : GetActiveStack()) { if (!Filter->Test(Edge)) { return false; } }
 		return true;
 	}
 
 	bool FManager::Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection)
 	{
-		for (const IFilter* Filter : Stack) { if (!Filter->Test(IO, ParentCollection)) { return false; } }
+		for (const IFilter* Filter : GetActiveStack()) { if (!Filter->Test(IO, ParentCollection)) { return false; } }
 		return true;
 	}
 
-#define PCGEX_TEST_STACK(_ITEM, _INDEX) bool bResult = true; for (const IFilter* Filter : Stack){if (!Filter->Test(_ITEM)){ bResult = false; break; }} OutResults[_INDEX] = bResult;
+#define PCGEX_TEST_STACK(_ITEM, _INDEX) bool bResult = true; for (const IFilter* Filter : GetActiveStack()){if (!Filter->Test(_ITEM)){ bResult = false; break; }} OutResults[_INDEX] = bResult;
 
 	int32 FManager::Test(const PCGExMT::FScope Scope, TArray<int8>& OutResults, const bool bParallel)
 	{
 		int32 NumPass = 0;
 
+		if (bAdaptiveOrdering && !bSamplingClaimed.load(std::memory_order_relaxed) && !bSamplingClaimed.exchange(true))
+		{
+			// Sample the head of the first scope, then test the remainder with the adaptive order
+			constexpr int32 SampleSize = 256;
+			const PCGExMT::FScope SampledScope(Scope.Start, FMath::Min(Scope.Count, SampleSize));
+			NumPass = SampleScope(SampledScope, SampledScope.GetView(OutResults));
+
+			if (SampledScope.Count == Scope.Count) { return NumPass; }
+			return NumPass + Test(PCGExMT::FScope(SampledScope.End, Scope.Count - SampledScope.Count), OutResults, bParallel);
+		}
+
+		if (bBatchTest)
+		{
+			if (!bParallel) { return TestScope(Scope, Scope.GetView(OutResults)); }
+
+			// Split into sub-scopes so each task still runs contiguous batches
+			constexpr int32 BatchSize = 256;
+			const int32 NumBatches = FMath::DivideAndRoundUp(Scope.Count, BatchSize);
+
+			ParallelFor(NumBatches, [&](const int32 i)
+			{
+				const int32 Start = Scope.Start + i * BatchSize;
+				const PCGExMT::FScope SubScope(Start, FMath::Min(BatchSize, Scope.End - Start));
+				FPlatformAtomics::InterlockedAdd(&NumPass, TestScope(SubScope, SubScope.GetView(OutResults)));
+			});
+
+			return NumPass;
+		}
+
 		if (bParallel)
 		{
 			ParallelFor(Scope.Count, [&](const int32 i)
@@ -336,6 +380,79 @@ namespace PCGExPointFilter
 		return NumPass;
 	}
 
+	int32 FManager::TestScope(const PCGExMT::FScope& Scope, TArrayView<int8> OutResults) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FManager::TestScope);
+
+		FMemory::Memset(OutResults.GetData(), 1, OutResults.Num() * sizeof(int8));
+		for (const IFilter* Filter : GetActiveStack()) { Filter->TestScope(Scope, OutResults); }
+
+		int32 NumPass = 0;
+		for (const int8 Result : OutResults) { NumPass += Result; }
+		return NumPass;
+	}
+
+	int32 FManager::SampleScope(const PCGExMT::FScope& Scope, TArrayView<int8> OutResults)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FManager::SampleScope);
+
+		const int32 NumFilters = Stack.Num();
+
+		TArray<double> Costs;
+		TArray<double> Rejections;
+		TArray<int8> Scratch;
+		Costs.SetNumUninitialized(NumFilters);
+		Rejections.SetNumUninitialized(NumFilters);
+		Scratch.SetNumUninitialized(Scope.Count);
+
+		FMemory::Memset(OutResults.GetData(), 1, OutResults.Num() * sizeof(int8));
+
+		// Every filter sees every point so rejection rates aren't biased by the current order
+		for (int i = 0; i < NumFilters; i++)
+		{
+			FMemory::Memset(Scratch.GetData(), 1, Scope.Count * sizeof(int8));
+
+			const uint64 StartCycles = FPlatformTime::Cycles64();
+			Stack[i]->TestScope(Scope, Scratch);
+			Costs[i] = static_cast<double>(FPlatformTime::Cycles64() - StartCycles) / Scope.Count;
+
+			int32 NumRejected = 0;
+			for (int j = 0; j < Scope.Count; j++)
+			{
+				NumRejected += !Scratch[j];
+				OutResults[j] &= Scratch[j];
+			}
+
+			Rejections[i] = static_cast<double>(NumRejected) / Scope.Count;
+		}
+
+		// Expected cost of a short-circuiting AND is minimized by ascending cost / rejection rate
+		TArray<int32> Order;
+		PCGExArrayHelpers::ArrayOfIndices(Order, NumFilters);
+		Order.StableSort(
+			[&](const int32 A, const int32 B)
+			{
+				return Costs[A] / FMath::Max(Rejections[A], UE_KINDA_SMALL_NUMBER) < Costs[B] / FMath::Max(Rejections[B], UE_KINDA_SMALL_NUMBER);
+			});
+
+		AdaptiveStack.Reset(NumFilters);
+		for (const int32 i : Order) { AdaptiveStack.Add(Stack[i]); }
+
+		if (PCGEX_CORE_SETTINGS.bLogAdaptiveFilterOrdering)
+		{
+			TArray<FString> Entries;
+			Entries.Reserve(NumFilters);
+			for (const int32 i : Order) { Entries.Add(FString::Printf(TEXT("%s (%.1f cycles/pt, %.0f%% rejected)"), *GetNameSafe(Stack[i]->Factory.Get()), Costs[i], Rejections[i] * 100)); }
+			UE_LOG(LogPCGEx, Log, TEXT("Adaptive filter order over %d samples : %s"), Scope.Count, *FString::Join(Entries, TEXT(" > ")));
+		}
+
+		ActiveStack.store(&AdaptiveStack, std::memory_order_release);
+
+		int32 NumPass = 0;
+		for (const int8 Result : OutResults) { NumPass += Result; }
+		return NumPass;
+	}
+
 	void FManager::SetSupportedTypes(const TSet<PCGExFactories::EType>* InTypes)
 	{
 		SupportedFactoriesTypes = InTypes;
@@ -370,6 +487,9 @@ namespace PCGExPointFilter
 			Stack.Add(Filter.Get());
 		}
 
+		// Reordering is only safe when the stack result is a plain AND
+		if (!bBatchTest || Stack.Num() < 2) { bAdaptiveOrdering = false; }
+
 		if (bCacheResults) { InitCache(); }
 
 		return true;
@@ -69,6 +69,7 @@ namespace PCGExPointStates
 		: FManager(InPointDataFacade)
 	{
 		FlagsCache = InFlags;
+		bBatchTest = false; // States are not a plain AND of filters
 	}
 
 	void FStateManager::PostInitFilter(FPCGExContext* InContext, const TSharedPtr<PCGExPointFilter::IFilter>& InFilter)
@@ -72,6 +72,26 @@ bool PCGExPointFilter::FBitmaskFilter::Test(const int32 PointIndex) const
 	return TypedFilterFactory->Config.bInvertResult ? !Result : Result;
 }
 
+void PCGExPointFilter::FBitmaskFilter::TestScope(const PCGExMT::FScope& Scope, TArrayView<int8> OutResults) const
+{
+	TArray<int64> Flags;
+	TArray<int64> Masks;
+	TArray<int8> Pass;
+	Flags.SetNumUninitialized(Scope.Count);
+	Masks.SetNumUninitialized(Scope.Count);
+	Pass.Init(1, Scope.Count);
+
+	FlagsReader->Read(Scope.Start, Flags);
+	MaskReader->ReadScope(Scope.Start, Masks);
+
+	if (!Compositions.IsEmpty()) { for (int64& Mask : Masks) { for (const FPCGExSimpleBitmask& Comp : Compositions) { Comp.Mutate(Mask); } } }
+
+	PCGExBitmask::CompareScope(TypedFilterFactory->Config.Comparison, Flags, Masks, Pass);
+
+	const int8 Invert = TypedFilterFactory->Config.bInvertResult ? 1 : 0;
+	for (int i = 0; i < Scope.Count; i++) { OutResults[i] &= (Pass[i] ^ Invert); }
+}
+
 bool PCGExPointFilter::FBitmaskFilter::Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const
 {
 	int64 OutFlags = 0;
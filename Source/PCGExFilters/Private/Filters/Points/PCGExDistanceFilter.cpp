@@ -104,6 +104,39 @@ bool PCGExPointFilter::FDistanceFilter::Test(const int32 PointIndex) const
 	return PCGExCompare::Compare(TypedFilterFactory->Config.Comparison, FMath::Sqrt(BestDist), B, TypedFilterFactory->Config.Tolerance);
 }
 
+void PCGExPointFilter::FDistanceFilter::TestScope(const PCGExMT::FScope& Scope, TArrayView<int8> OutResults) const
+{
+	if (bCheckAgainstDataBounds)
+	{
+		if (!bCollectionTestResult) { FMemory::Memzero(OutResults.GetData(), OutResults.Num() * sizeof(int8)); }
+		return;
+	}
+
+	TArray<double> Distances;
+	TArray<double> Thresholds;
+	Distances.SetNumUninitialized(Scope.Count);
+	Thresholds.SetNumUninitialized(Scope.Count);
+
+	DistanceThresholdGetter->ReadScope(Scope.Start, Thresholds);
+
+	// Closest-target queries dominate, only run them for entries that are still passing
+	for (int i = 0; i < Scope.Count; i++)
+	{
+		if (!OutResults[i])
+		{
+			Distances[i] = 0;
+			continue;
+		}
+
+		PCGExData::FConstPoint TargetPt;
+		double BestDist = MAX_dbl;
+		TargetsHandler->FindClosestTarget(PointDataFacade->Source->GetInPoint(Scope.Start + i), TargetPt, BestDist, &IgnoreList);
+		Distances[i] = FMath::Sqrt(BestDist);
+	}
+
+	PCGExCompare::CompareScope(TypedFilterFactory->Config.Comparison, Distances, Thresholds, OutResults, TypedFilterFactory->Config.Tolerance);
+}
+
 bool PCGExPointFilter::FDistanceFilter::Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const
 {
 	PCGExData::FProxyPoint ProxyPoint;
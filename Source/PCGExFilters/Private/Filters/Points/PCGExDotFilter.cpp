@@ -86,6 +86,32 @@ bool PCGExPointFilter::FDotFilter::Test(const int32 PointIndex) const
 	return DotComparison.Test(FVector::DotProduct(TypedFilterFactory->Config.bTransformOperandA ? InTransforms[PointIndex].TransformVectorNoScale(OperandA->Read(PointIndex) * OperandAMultiplier) : OperandA->Read(PointIndex) * OperandAMultiplier, TypedFilterFactory->Config.bTransformOperandB ? InTransforms[PointIndex].TransformVectorNoScale(B) : B), PointIndex);
 }
 
+void PCGExPointFilter::FDotFilter::TestScope(const PCGExMT::FScope& Scope, TArrayView<int8> OutResults) const
+{
+	TArray<FVector> A;
+	TArray<FVector> B;
+	TArray<double> Dots;
+	A.SetNumUninitialized(Scope.Count);
+	B.SetNumUninitialized(Scope.Count);
+	Dots.SetNumUninitialized(Scope.Count);
+
+	OperandA->Read(Scope.Start, A);
+	OperandB->ReadScope(Scope.Start, B);
+
+	const bool bTransformA = TypedFilterFactory->Config.bTransformOperandA;
+	const bool bTransformB = TypedFilterFactory->Config.bTransformOperandB;
+
+	for (int i = 0; i < Scope.Count; i++)
+	{
+		const FTransform& Transform = InTransforms[Scope.Start + i];
+		const FVector VA = A[i] * OperandAMultiplier;
+		const FVector VB = B[i].GetSafeNormal() * OperandBMultiplier;
+		Dots[i] = FVector::DotProduct(bTransformA ? Transform.TransformVectorNoScale(VA) : VA, bTransformB ? Transform.TransformVectorNoScale(VB) : VB);
+	}
+
+	DotComparison.TestScope(Scope.Start, Dots, OutResults);
+}
+
 bool PCGExPointFilter::FDotFilter::Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const
 {
 	PCGEX_SHARED_CONTEXT(IO->GetContextHandle())
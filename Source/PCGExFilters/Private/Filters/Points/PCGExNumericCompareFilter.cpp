@@ -68,6 +68,19 @@ bool PCGExPointFilter::FNumericCompareFilter::Test(const int32 PointIndex) const
 	return PCGExCompare::Compare(TypedFilterFactory->Config.Comparison, A, B, TypedFilterFactory->Config.Tolerance);
 }
 
+void PCGExPointFilter::FNumericCompareFilter::TestScope(const PCGExMT::FScope& Scope, TArrayView<int8> OutResults) const
+{
+	TArray<double> A;
+	TArray<double> B;
+	A.SetNumUninitialized(Scope.Count);
+	B.SetNumUninitialized(Scope.Count);
+
+	OperandA->Read(Scope.Start, A);
+	OperandB->ReadScope(Scope.Start, B);
+
+	PCGExCompare::CompareScope(TypedFilterFactory->Config.Comparison, A, B, OutResults, TypedFilterFactory->Config.Tolerance);
+}
+
 bool PCGExPointFilter::FNumericCompareFilter::Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const
 {
 	double A = 0;
@@ -81,6 +81,29 @@ bool PCGExPointFilter::FWithinRangeFilter::Test(const int32 PointIndex) const
 	return bInvert;
 }
 
+void PCGExPointFilter::FWithinRangeFilter::TestScope(const PCGExMT::FScope& Scope, TArrayView<int8> OutResults) const
+{
+	TArray<double> A;
+	TArray<int8> Within;
+	A.SetNumUninitialized(Scope.Count);
+	Within.SetNumZeroed(Scope.Count);
+
+	OperandA->Read(Scope.Start, A);
+
+	// One branch-free pass per range, OR-ing into Within
+	for (const FPCGExPickerConstantRangeConfig& Range : Ranges)
+	{
+		const double Min = Range.RelativeStartIndex;
+		const double Max = Range.RelativeEndIndex;
+
+		if (bInclusive) { for (int i = 0; i < Scope.Count; i++) { Within[i] |= static_cast<int8>((A[i] >= Min) & (A[i] <= Max)); } }
+		else { for (int i = 0; i < Scope.Count; i++) { Within[i] |= static_cast<int8>((A[i] >= Min) & (A[i] < Max)); } }
+	}
+
+	const int8 Invert = bInvert ? 1 : 0;
+	for (int i = 0; i < Scope.Count; i++) { OutResults[i] &= (Within[i] ^ Invert); }
+}
+
 bool PCGExPointFilter::FWithinRangeFilter::Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const
 {
 	double A = 0;
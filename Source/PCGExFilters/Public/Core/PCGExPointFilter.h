@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "CoreMinimal.h"
 #include "PCGExFilterCommon.h"
 #include "UObject/Object.h"
@@ -134,6 +136,12 @@ namespace PCGExPointFilter
 
 		virtual bool Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const; // destined for collection only, is expected to test internal PointDataFacade directly.
 
+		/**
+		 * Batch evaluation over a contiguous range of point indices. OutResults[i] maps to Scope.Start + i and is AND-ed with this filter result.
+		 * Entries that already failed may be skipped. Default implementation falls back to per-point Test.
+		 */
+		virtual void TestScope(const PCGExMT::FScope& Scope, TArrayView<int8> OutResults) const;
+
 		virtual void SetSupportedTypes(const TSet<PCGExFactories::EType>* InTypes)
 		{
 		}
@@ -173,6 +181,8 @@ namespace PCGExPointFilter
 		virtual bool Test(const PCGExClusters::FNode& Node) const override final;
 		virtual bool Test(const PCGExGraphs::FEdge& Edge) const override final;
 		virtual bool Test(const TSharedPtr<PCGExData::FPointIO>& IO, const TSharedPtr<PCGExData::FPointIOCollection>& ParentCollection) const override;
+
+		virtual void TestScope(const PCGExMT::FScope& Scope, TArrayView<int8> OutResults) const override;
 	};
 
 	class PCGEXFILTERS_API FManager : public TSharedFromThis<FManager>
@@ -187,6 +197,9 @@ namespace PCGExPointFilter
 		bool bCacheResults = false;
 		TArray<int8> Results;
 
+		/** Sample filters on the first tested scope and reorder the stack by cost & rejection rate for subsequent tests. */
+		bool bAdaptiveOrdering = false;
+
 		bool bValid = false;
 
 		TSharedRef<PCGExData::FFacade> PointDataFacade;
@@ -218,6 +231,19 @@ namespace PCGExPointFilter
 		TArray<TSharedPtr<IFilter>> ManagedFilters;
 		TArray<const IFilter*> Stack;
 
+		// Whether scope tests can go through IFilter::TestScope, i.e the result is the AND of all filters
+		bool bBatchTest = true;
+
+		// Stack is never mutated after init; adaptive ordering publishes a reordered copy once, and readers go through ActiveStack.
+		TArray<const IFilter*> AdaptiveStack;
+		std::atomic<const TArray<const IFilter*>*> ActiveStack{&Stack};
+		std::atomic<bool> bSamplingClaimed{false};
+
+		FORCEINLINE const TArray<const IFilter*>& GetActiveStack() const { return *ActiveStack.load(std::memory_order_acquire); }
+
+		int32 TestScope(const PCGExMT::FScope& Scope, TArrayView<int8> OutResults) const;
+		int32 SampleScope(const PCGExMT::FScope& Scope, TArrayView<int8> OutResults);
+
 		virtual bool InitFilter(FPCGExContext* InContext, const TSharedPtr<IFilter>& Filter);
 		virtual bool PostInit(FPCGExContext* InContext);
 		virtual void PostInitFilter(FPCGExContext* InContext, const TSharedPtr<IFilter>& InFilter);
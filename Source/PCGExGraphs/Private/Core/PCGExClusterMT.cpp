@@ -10,6 +10,7 @@
 #include "Data/PCGExClusterData.h"
 #include "PCGExHeuristicsHandler.h"
 #include "Clusters/PCGExClustersHelpers.h"
+#include "Clusters/PCGExClusterDiskCache.h"
 #include "Core/PCGExClusterFilter.h"
 #include "Graphs/PCGExGraphBuilder.h"
 #include "Graphs/PCGExGraphHelpers.h"
@@ -119,11 +120,19 @@ namespace PCGExClusterMT
 			Cluster = MakeShared<PCGExClusters::FCluster>(VtxDataFacade->Source, EdgeDataFacade->Source, NodeIndexLookup);
 			Cluster->bIsOneToOne = bIsOneToOne;
 
-			if (!Cluster->BuildFrom(*EndpointsLookup, ExpectedAdjacency))
+			const bool bUseDiskCache = PCGExClusters::DiskCache::IsEnabled(VtxDataFacade->GetNum());
+			const PCGExClusters::DiskCache::FKey DiskCacheKey = bUseDiskCache ? PCGExClusters::DiskCache::ComputeKey(VtxDataFacade->Source, EdgeDataFacade->Source) : PCGExClusters::DiskCache::FKey();
+
+			if (!DiskCacheKey.IsValid() || !PCGExClusters::DiskCache::TryLoad(Cluster.ToSharedRef(), DiskCacheKey))
 			{
-				PCGE_LOG_C(Error, GraphAndLog, ExecutionContext, FTEXT("A cluster could not be rebuilt correctly. If you did change the content of vtx/edges collections using non cluster-friendly nodes, make sure to use a 'Sanitize Cluster' to ensure clusters are validated."));
-				Cluster.Reset();
-				return false;
+				if (!Cluster->BuildFrom(*EndpointsLookup, ExpectedAdjacency))
+				{
+					PCGE_LOG_C(Error, GraphAndLog, ExecutionContext, FTEXT("A cluster could not be rebuilt correctly. If you did change the content of vtx/edges collections using non cluster-friendly nodes, make sure to use a 'Sanitize Cluster' to ensure clusters are validated."));
+					Cluster.Reset();
+					return false;
+				}
+
+				if (DiskCacheKey.IsValid()) { PCGExClusters::DiskCache::Save(Cluster.ToSharedRef(), DiskCacheKey); }
 			}
 		}
 
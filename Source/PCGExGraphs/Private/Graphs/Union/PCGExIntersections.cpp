@@ -47,6 +47,76 @@ namespace PCGExGraphs
 		Adjacency.Add(InAdjacency);
 	}
 
+	FUnionNodeHash::FUnionNodeHash(const FVector& InCellSize)
+	{
+		static_assert(FMath::IsPowerOfTwo(NumShards));
+		const FVector SafeCellSize = PCGEx::SafeTolerance(InCellSize);
+		InvCellSize = FVector(1 / SafeCellSize.X, 1 / SafeCellSize.Y, 1 / SafeCellSize.Z);
+	}
+
+	void FUnionNodeHash::Reserve(const int32 NumNodes)
+	{
+		const int32 NumReserve = NumNodes / NumShards;
+		for (int32 i = 0; i < NumShards; i++) { Shards[i].Reserve(NumReserve); }
+	}
+
+	void FUnionNodeHash::GetShards(const FBox& QueryBox, FShardList& OutShards) const
+	{
+		OutShards.Reset();
+
+		const FInt64Vector3 Min = GetCell(QueryBox.Min);
+		const FInt64Vector3 Max = GetCell(QueryBox.Max);
+
+		for (int64 X = Min.X; X <= Max.X; X++)
+		{
+			for (int64 Y = Min.Y; Y <= Max.Y; Y++)
+			{
+				for (int64 Z = Min.Z; Z <= Max.Z; Z++) { OutShards.AddUnique(GetShard(GetCellKey(X, Y, Z))); }
+			}
+		}
+
+		// Ascending lock order prevents deadlocks between overlapping neighborhoods
+		OutShards.Sort();
+	}
+
+	void FUnionNodeHash::Lock(const FShardList& InShards)
+	{
+		for (const uint32 Shard : InShards) { Locks[Shard].WriteLock(); }
+	}
+
+	void FUnionNodeHash::Unlock(const FShardList& InShards)
+	{
+		for (int32 i = InShards.Num() - 1; i >= 0; i--) { Locks[InShards[i]].WriteUnlock(); }
+	}
+
+	void FUnionNodeHash::ForEachCandidate(const FBox& QueryBox, TFunctionRef<void(const FUnionNode*)> Func) const
+	{
+		const FInt64Vector3 Min = GetCell(QueryBox.Min);
+		const FInt64Vector3 Max = GetCell(QueryBox.Max);
+
+		for (int64 X = Min.X; X <= Max.X; X++)
+		{
+			for (int64 Y = Min.Y; Y <= Max.Y; Y++)
+			{
+				for (int64 Z = Min.Z; Z <= Max.Z; Z++)
+				{
+					const uint64 Key = GetCellKey(X, Y, Z);
+					if (const FCell* Cell = Shards[GetShard(Key)].Find(Key))
+					{
+						for (const FUnionNode* Node : *Cell) { Func(Node); }
+					}
+				}
+			}
+		}
+	}
+
+	void FUnionNodeHash::Add(const FUnionNode* Node)
+	{
+		const FInt64Vector3 Cell = GetCell(Node->Center);
+		const uint64 Key = GetCellKey(Cell.X, Cell.Y, Cell.Z);
+		Shards[GetShard(Key)].FindOrAdd(Key).Add(Node);
+	}
+
 	FUnionGraph::FUnionGraph(const FPCGExFuseDetails& InFuseDetails, const FBox& InBounds, const TSharedPtr<PCGExData::FPointIOCollection>& InSourceCollection)
 		: SourceCollection(InSourceCollection), FuseDetails(InFuseDetails), Bounds(InBounds)
 	{
@@ -60,6 +130,19 @@ namespace PCGExGraphs
 		{
 			Octree = MakeUnique<FUnionNodeOctree>(Bounds.GetCenter(), Bounds.GetExtent().Length() + 10);
 		}
+		else if (FuseDetails.FuseMethod == EPCGExFuseMethod::Concurrent)
+		{
+			if (FuseDetails.SupportsConcurrentHash())
+			{
+				// Cells twice the tolerance wide so a query box never spans more than 2x2x2 cells
+				NodeHash = MakeShared<FUnionNodeHash>((FuseDetails.bComponentWiseTolerance ? FuseDetails.Tolerances : FVector(FuseDetails.Tolerance)) * 2);
+			}
+			else
+			{
+				// Bounds-based distances or per-point tolerances can't be bound to a fixed cell size
+				Octree = MakeUnique<FUnionNodeOctree>(Bounds.GetCenter(), Bounds.GetExtent().Length() + 10);
+			}
+		}
 	}
 
 	bool FUnionGraph::Init(FPCGExContext* InContext)
@@ -76,7 +159,11 @@ namespace PCGExGraphs
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FUnionGraph::Reserve);
 
-		if (!Octree)
+		if (NodeHash)
+		{
+			NodeHash->Reserve(NodeReserve);
+		}
+		else if (!Octree)
 		{
 			if (FuseDetails.DoInlineInsertion()) { NodeBins.Reserve(NodeReserve); }
 			else { NodeBinsShards.Reserve(NodeReserve); }
@@ -105,6 +192,8 @@ namespace PCGExGraphs
 
 	int32 FUnionGraph::InsertPoint(const PCGExData::FConstPoint& Point)
 	{
+		if (NodeHash) { return InsertPoint_Hash<true>(Point); }
+
 		const FVector Origin = Point.GetLocation();
 
 		if (!Octree)
@@ -167,6 +256,8 @@ namespace PCGExGraphs
 
 	int32 FUnionGraph::InsertPoint_Unsafe(const PCGExData::FConstPoint& Point)
 	{
+		if (NodeHash) { return InsertPoint_Hash<false>(Point); }
+
 		const FVector Origin = Point.GetLocation();
 
 		if (!Octree)
@@ -211,6 +302,72 @@ namespace PCGExGraphs
 		return Nodes.Add(Node);
 	}
 
+	template <bool bThreadSafe>
+	int32 FUnionGraph::InsertPoint_Hash(const PCGExData::FConstPoint& Point)
+	{
+		const FVector Origin = Point.GetLocation();
+		const FBox QueryBox = FuseDetails.GetOctreeBox(Origin, Point.Index);
+
+		FUnionNodeHash::FShardList NeighborhoodShards;
+		if constexpr (bThreadSafe)
+		{
+			// Only the shards covering this point's neighborhood are locked,
+			// so insertions that are far apart never contend with each other
+			NodeHash->GetShards(QueryBox, NeighborhoodShards);
+			NodeHash->Lock(NeighborhoodShards);
+		}
+
+		int32 ClosestIndex = -1;
+		double ClosestDistSquared = MAX_dbl;
+
+		NodeHash->ForEachCandidate(QueryBox, [&](const FUnionNode* ExistingNode)
+		{
+			const bool bIsWithin = FuseDetails.bComponentWiseTolerance ? FuseDetails.IsWithinToleranceComponentWise(Point, ExistingNode->Point) : FuseDetails.IsWithinTolerance(Point, ExistingNode->Point);
+			if (!bIsWithin) { return; }
+
+			// Ties are resolved toward the oldest node so the result doesn't depend on cell iteration order
+			const double DistSquared = FVector::DistSquared(Origin, ExistingNode->Center);
+			if (DistSquared < ClosestDistSquared || (DistSquared == ClosestDistSquared && ExistingNode->Index < ClosestIndex))
+			{
+				ClosestDistSquared = DistSquared;
+				ClosestIndex = ExistingNode->Index;
+			}
+		});
+
+		int32 NodeIndex = ClosestIndex;
+
+		if (NodeIndex != -1)
+		{
+			if constexpr (bThreadSafe) { NodesUnion->Append(NodeIndex, Point); }
+			else { NodesUnion->Append_Unsafe(NodeIndex, Point); }
+		}
+		else
+		{
+			TSharedPtr<FUnionNode> Node;
+
+			if constexpr (bThreadSafe)
+			{
+				// Short critical section, only covers the node allocation
+				FWriteScopeLock WriteScopeLock(UnionLock);
+				NodesUnion->NewEntry_Unsafe(Point);
+				Node = MakeShared<FUnionNode>(Point, Origin, Nodes.Num());
+				NodeIndex = Nodes.Add(Node);
+			}
+			else
+			{
+				NodesUnion->NewEntry_Unsafe(Point);
+				Node = MakeShared<FUnionNode>(Point, Origin, Nodes.Num());
+				NodeIndex = Nodes.Add(Node);
+			}
+
+			NodeHash->Add(Node.Get());
+		}
+
+		if constexpr (bThreadSafe) { NodeHash->Unlock(NeighborhoodShards); }
+
+		return NodeIndex;
+	}
+
 	void FUnionGraph::InsertEdge(const PCGExData::FConstPoint& From, const PCGExData::FConstPoint& To, const PCGExData::FConstPoint& Edge)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(IUnionData::InsertEdge);
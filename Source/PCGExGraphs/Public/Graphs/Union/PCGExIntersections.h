@@ -74,6 +74,74 @@ namespace PCGExGraphs
 
 	PCGEX_OCTREE_SEMANTICS(FUnionNode, { return Element->Bounds;}, { return A->Index == B->Index; })
 
+	/**
+	 * Sharded spatial hash backing the concurrent fuse method.
+	 * Cells are sized after the fuse tolerance so a query only ever probes its immediate neighbor cells.
+	 * Concurrent insertions only lock the shards covering their own neighborhood, always in ascending order.
+	 */
+	class PCGEXGRAPHS_API FUnionNodeHash : public TSharedFromThis<FUnionNodeHash>
+	{
+	public:
+		static constexpr int32 NumShards = 256;
+		using FShardList = TArray<uint32, TInlineAllocator<8>>;
+		using FCell = TArray<const FUnionNode*, TInlineAllocator<4>>;
+
+	protected:
+		const int32 Log2NumShards = FMath::FloorLog2(NumShards);
+		FVector InvCellSize = FVector::OneVector;
+
+		TStaticArray<TMap<uint64, FCell>, NumShards> Shards;
+		TStaticArray<FRWLock, NumShards> Locks;
+
+	public:
+		explicit FUnionNodeHash(const FVector& InCellSize);
+
+		void Reserve(const int32 NumNodes);
+
+		/** Collect the sorted, unique shards touched by the query box */
+		void GetShards(const FBox& QueryBox, FShardList& OutShards) const;
+
+		void Lock(const FShardList& InShards);
+		void Unlock(const FShardList& InShards);
+
+		/** Not thread-safe on its own, relevant shards must be locked */
+		void ForEachCandidate(const FBox& QueryBox, TFunctionRef<void(const FUnionNode*)> Func) const;
+
+		/** Not thread-safe on its own, relevant shards must be locked */
+		void Add(const FUnionNode* Node);
+
+	protected:
+		// Small tolerances over large coordinates easily exceed int32 cell coordinates, so cells are 64bit.
+		// Clamped well inside int64 range so the conversion stays defined and neighbor iteration can't wrap.
+		FORCEINLINE static int64 ToCell(const double Value)
+		{
+			constexpr double MaxCell = 4611686018427387904.0; // 2^62
+			return FMath::FloorToInt64(FMath::Clamp(Value, -MaxCell, MaxCell));
+		}
+
+		FORCEINLINE FInt64Vector3 GetCell(const FVector& Location) const
+		{
+			return FInt64Vector3(
+				ToCell(Location.X * InvCellSize.X),
+				ToCell(Location.Y * InvCellSize.Y),
+				ToCell(Location.Z * InvCellSize.Z));
+		}
+
+		FORCEINLINE static uint64 GetCellKey(const int64 X, const int64 Y, const int64 Z)
+		{
+			uint64 Hash = 14695981039346656037ULL;
+			Hash = (Hash ^ static_cast<uint64>(X)) * 1099511628211ULL;
+			Hash = (Hash ^ static_cast<uint64>(Y)) * 1099511628211ULL;
+			Hash = (Hash ^ static_cast<uint64>(Z)) * 1099511628211ULL;
+			return Hash;
+		}
+
+		FORCEINLINE uint32 GetShard(const uint64 Key) const
+		{
+			return static_cast<uint32>((Key * 2654435761ULL) >> (64 - Log2NumShards));
+		}
+	};
+
 	class PCGEXGRAPHS_API FUnionGraph : public TSharedFromThis<FUnionGraph>
 	{
 		int32 NumCollapsedEdges = 0;
@@ -96,6 +164,7 @@ namespace PCGExGraphs
 		FBox Bounds;
 
 		TUniquePtr<FUnionNodeOctree> Octree;
+		TSharedPtr<FUnionNodeHash> NodeHash;
 
 		mutable FRWLock UnionLock;
 		mutable FRWLock EdgesLock;
@@ -123,6 +192,10 @@ namespace PCGExGraphs
 		void WriteEdgeMetadata(const TSharedPtr<FGraph>& InGraph) const;
 
 		void Collapse();
+
+	protected:
+		template <bool bThreadSafe>
+		int32 InsertPoint_Hash(const PCGExData::FConstPoint& Point);
 	};
 
 #pragma endregion
@@ -101,10 +101,12 @@ namespace PCGExHeuristics
 
 		Cluster = InCluster;
 		bUseDynamicWeight = false;
+		bGoalDependentEdgeScores = false;
 		for (const TSharedPtr<FPCGExHeuristicOperation>& Operation : Operations)
 		{
 			Operation->PrepareForCluster(InCluster);
 			if (Operation->bHasCustomLocalWeightMultiplier) { bUseDynamicWeight = true; }
+			if (Operation->IsEdgeScoreGoalDependent()) { bGoalDependentEdgeScores = true; }
 		}
 	}
 
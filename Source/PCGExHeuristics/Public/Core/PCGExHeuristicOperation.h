@@ -52,6 +52,8 @@ public:
 
 	virtual double GetEdgeScore(const PCGExClusters::FNode& From, const PCGExClusters::FNode& To, const PCGExGraphs::FEdge& Edge, const PCGExClusters::FNode& Seed, const PCGExClusters::FNode& Goal, const TSharedPtr<PCGEx::FHashLookup> TravelStack = nullptr) const;
 
+	/** Whether GetEdgeScore reads the goal node; if not, a single search tree can answer every goal of a given seed */
+	virtual bool IsEdgeScoreGoalDependent() const { return false; }
 
 	double GetCustomWeightMultiplier(const int32 PointIndex, const int32 EdgeIndex) const;
 
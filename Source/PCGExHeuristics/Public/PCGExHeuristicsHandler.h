@@ -67,11 +67,13 @@ namespace PCGExHeuristics
 		double ReferenceWeight = 1;
 		double TotalStaticWeight = 0;
 		bool bUseDynamicWeight = false;
+		bool bGoalDependentEdgeScores = false;
 
 		bool IsValidHandler() const { return bIsValidHandler; }
 		bool HasGlobalFeedback() const { return !Feedbacks.IsEmpty(); };
 		bool HasLocalFeedback() const { return !LocalFeedbackFactories.IsEmpty(); };
 		bool HasAnyFeedback() const { return HasGlobalFeedback() || HasLocalFeedback(); };
+		bool HasGoalDependentEdgeScores() const { return bGoalDependentEdgeScores; };
 
 		FHandler(FPCGExContext* InContext, const TSharedPtr<PCGExData::FFacade>& InVtxDataCache, const TSharedPtr<PCGExData::FFacade>& InEdgeDataCache, const TArray<TObjectPtr<const UPCGExHeuristicsFactoryData>>& InFactories);
 		~FHandler();
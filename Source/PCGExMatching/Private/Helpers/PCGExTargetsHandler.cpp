@@ -8,6 +8,7 @@
 #include "Data/PCGExPointIO.h"
 #include "Details/PCGExDistancesDetails.h"
 #include "Helpers/PCGExDataMatcher.h"
+#include "Math/PCGExKDTree.h"
 #include "Math/PCGExMathDistances.h"
 
 namespace PCGExMatching
@@ -318,6 +319,120 @@ namespace PCGExMatching
 		});
 	}
 
+	void FTargetsHandler::BuildPointsIndex()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FTargetsHandler::BuildPointsIndex);
+
+		PointsIndexOffsets.SetNumUninitialized(TargetFacades.Num());
+
+		int32 NumPoints = 0;
+		for (int i = 0; i < TargetFacades.Num(); i++)
+		{
+			PointsIndexOffsets[i] = NumPoints;
+			NumPoints += TargetFacades[i]->GetNum();
+		}
+
+		TArray<FVector> Positions;
+		Positions.SetNumUninitialized(NumPoints);
+		PointsIndexIO.SetNumUninitialized(NumPoints);
+
+		for (int i = 0; i < TargetFacades.Num(); i++)
+		{
+			const TConstPCGValueRange<FTransform> Transforms = TargetFacades[i]->GetIn()->GetConstTransformValueRange();
+			const int32 Offset = PointsIndexOffsets[i];
+			for (int j = 0; j < Transforms.Num(); j++)
+			{
+				Positions[Offset + j] = Transforms[j].GetLocation();
+				PointsIndexIO[Offset + j] = i;
+			}
+		}
+
+		PointsIndex = MakeShared<PCGExMath::FKDTree>();
+		PointsIndex->Build(Positions);
+	}
+
+	void FTargetsHandler::GetExcludedTargets(const TSet<const UPCGData*>* Exclude, TBitArray<>& OutExcluded) const
+	{
+		OutExcluded.Init(false, TargetFacades.Num());
+		if (!Exclude || Exclude->IsEmpty()) { return; }
+		for (int i = 0; i < TargetFacades.Num(); i++) { OutExcluded[i] = Exclude->Contains(TargetFacades[i]->GetIn()); }
+	}
+
+	bool FTargetsHandler::FindNearestIndexed(const FVector& Probe, PCGExData::FConstPoint& OutResult, double& OutDistSquared, const TSet<const UPCGData*>* Exclude) const
+	{
+		if (Exclude && !Exclude->IsEmpty())
+		{
+			TBitArray<> Excluded;
+			GetExcludedTargets(Exclude, Excluded);
+			return FindNearestIndexed(Probe, OutResult, OutDistSquared, Excluded);
+		}
+
+		const int32 Item = PointsIndex->FindNearest(Probe, OutDistSquared);
+		if (Item == -1) { return false; }
+
+		const int32 IO = PointsIndexIO[Item];
+		OutResult = TargetFacades[IO]->GetInPoint(Item - PointsIndexOffsets[IO]);
+		OutResult.IO = IO;
+
+		return true;
+	}
+
+	bool FTargetsHandler::FindNearestIndexed(const FVector& Probe, PCGExData::FConstPoint& OutResult, double& OutDistSquared, const TBitArray<>& Excluded) const
+	{
+		const int32 Item = PointsIndex->FindNearest(Probe, OutDistSquared, [&](const int32 InItem) { return !Excluded[PointsIndexIO[InItem]]; });
+		if (Item == -1) { return false; }
+
+		const int32 IO = PointsIndexIO[Item];
+		OutResult = TargetFacades[IO]->GetInPoint(Item - PointsIndexOffsets[IO]);
+		OutResult.IO = IO;
+
+		return true;
+	}
+
+	void FTargetsHandler::FindKNearestIndexed(const FVector& Probe, const int32 K, TArray<PCGExData::FConstPoint>& OutResults, TArray<double>& OutDistSquared, const TSet<const UPCGData*>* Exclude) const
+	{
+		TBitArray<> Excluded;
+		GetExcludedTargets(Exclude, Excluded);
+		FindKNearestIndexed(Probe, K, OutResults, OutDistSquared, Excluded);
+	}
+
+	void FTargetsHandler::FindKNearestIndexed(const FVector& Probe, const int32 K, TArray<PCGExData::FConstPoint>& OutResults, TArray<double>& OutDistSquared, const TBitArray<>& Excluded) const
+	{
+		TArray<PCGExMath::FKDTree::FNearest> Nearest;
+		PointsIndex->FindKNearest(Probe, K, Nearest, [&](const int32 InItem) { return !Excluded[PointsIndexIO[InItem]]; });
+
+		OutResults.Reset(Nearest.Num());
+		OutDistSquared.Reset(Nearest.Num());
+
+		for (const PCGExMath::FKDTree::FNearest& N : Nearest)
+		{
+			const int32 IO = PointsIndexIO[N.Item];
+			PCGExData::FConstPoint& Point = OutResults.Add_GetRef(TargetFacades[IO]->GetInPoint(N.Item - PointsIndexOffsets[IO]));
+			Point.IO = IO;
+			OutDistSquared.Add(N.DistSquared);
+		}
+	}
+
+	void FTargetsHandler::ForEachIndexedPointInRadius(const FVector& Probe, const double Radius, FPointIteratorWithData&& Func, const TSet<const UPCGData*>* Exclude) const
+	{
+		TBitArray<> Excluded;
+		GetExcludedTargets(Exclude, Excluded);
+		ForEachIndexedPointInRadius(Probe, Radius, MoveTemp(Func), Excluded);
+	}
+
+	void FTargetsHandler::ForEachIndexedPointInRadius(const FVector& Probe, const double Radius, FPointIteratorWithData&& Func, const TBitArray<>& Excluded) const
+	{
+		PointsIndex->ForEachInRadius(Probe, FMath::Square(Radius), [&](const int32 InItem, const double)
+		{
+			const int32 IO = PointsIndexIO[InItem];
+			if (Excluded[IO]) { return; }
+
+			PCGExData::FConstPoint Point = TargetFacades[IO]->GetInPoint(InItem - PointsIndexOffsets[IO]);
+			Point.IO = IO;
+			Func(Point);
+		});
+	}
+
 	PCGExData::FConstPoint FTargetsHandler::GetPoint(const int32 IO, const int32 Index) const
 	{
 		return TargetFacades[IO]->GetInPoint(Index);
@@ -25,6 +25,7 @@ namespace PCGExMatching
 namespace PCGExMath
 {
 	class IDistances;
+	class FKDTree;
 }
 
 namespace PCGExData
@@ -48,6 +49,11 @@ namespace PCGExMatching
 
 		const PCGExMath::IDistances* Distances = nullptr;
 
+		// Flattened index over every target point, along with the target id & offset of each entry
+		TSharedPtr<PCGExMath::FKDTree> PointsIndex;
+		TArray<int32> PointsIndexIO;
+		TArray<int32> PointsIndexOffsets;
+
 	public:
 		using FInitData = std::function<FBox(const TSharedPtr<PCGExData::FPointIO>&, const int32)>;
 		using FFacadeRefIterator = std::function<void(const TSharedRef<PCGExData::FFacade>&, const int32)>;
@@ -92,6 +98,24 @@ namespace PCGExMatching
 		void FindClosestTarget(const PCGExData::FConstPoint& Probe, PCGExData::FConstPoint& OutResult, double& OutDistSquared, const TSet<const UPCGData*>* Exclude = nullptr) const;
 		void FindClosestTarget(const FVector& Probe, PCGExData::FConstPoint& OutResult, double& OutDistSquared, const TSet<const UPCGData*>* Exclude = nullptr) const;
 
+		/**
+		 * Builds a single kd-tree over the center of every target point, across all targets.
+		 * Indexed queries below measure center-to-center euclidean distances and ignore the handler's distance settings.
+		 */
+		void BuildPointsIndex();
+		bool HasPointsIndex() const { return PointsIndex.IsValid(); }
+
+		/** One bit per target, set if that target is part of Exclude. Build it once per scope and reuse it across indexed queries. */
+		void GetExcludedTargets(const TSet<const UPCGData*>* Exclude, TBitArray<>& OutExcluded) const;
+
+		/** Exact distance ties resolve towards the lowest target, then the lowest point index, same as a linear ForEachTargetPoint scan. */
+		bool FindNearestIndexed(const FVector& Probe, PCGExData::FConstPoint& OutResult, double& OutDistSquared, const TSet<const UPCGData*>* Exclude = nullptr) const;
+		bool FindNearestIndexed(const FVector& Probe, PCGExData::FConstPoint& OutResult, double& OutDistSquared, const TBitArray<>& Excluded) const;
+		void FindKNearestIndexed(const FVector& Probe, const int32 K, TArray<PCGExData::FConstPoint>& OutResults, TArray<double>& OutDistSquared, const TSet<const UPCGData*>* Exclude = nullptr) const;
+		void FindKNearestIndexed(const FVector& Probe, const int32 K, TArray<PCGExData::FConstPoint>& OutResults, TArray<double>& OutDistSquared, const TBitArray<>& Excluded) const;
+		void ForEachIndexedPointInRadius(const FVector& Probe, const double Radius, FPointIteratorWithData&& Func, const TSet<const UPCGData*>* Exclude = nullptr) const;
+		void ForEachIndexedPointInRadius(const FVector& Probe, const double Radius, FPointIteratorWithData&& Func, const TBitArray<>& Excluded) const;
+
 		PCGExData::FConstPoint GetPoint(const int32 IO, const int32 Index) const;
 		PCGExData::FConstPoint GetPoint(const PCGExData::FPoint& Point) const;
 
@@ -39,38 +39,139 @@ double FPCGExNoise3DOperation::GetDouble(const FVector& Position) const
 	return ApplyRemap(GenerateFractal(TransformPosition(Position)));
 }
 
+namespace PCGExNoise3D
+{
+	// Position offsets used to derive independent vector components from the scalar noise
+	static const FVector ComponentOffsets[4] = {
+		FVector::ZeroVector,
+		FVector(127.1, 311.7, 74.7),
+		FVector(269.5, 183.3, 246.1),
+		FVector(419.2, 371.9, 168.2)
+	};
+}
+
 FVector2D FPCGExNoise3DOperation::GetVector2D(const FVector& Position) const
 {
 	// Generate two independent noise values using position offsets
 	const double X = GetDouble(Position);
-	const double Y = GetDouble(Position + FVector(127.1, 311.7, 74.7));
+	const double Y = GetDouble(Position + PCGExNoise3D::ComponentOffsets[1]);
 	return FVector2D(X, Y);
 }
 
 FVector FPCGExNoise3DOperation::GetVector(const FVector& Position) const
 {
 	const double X = GetDouble(Position);
-	const double Y = GetDouble(Position + FVector(127.1, 311.7, 74.7));
-	const double Z = GetDouble(Position + FVector(269.5, 183.3, 246.1));
+	const double Y = GetDouble(Position + PCGExNoise3D::ComponentOffsets[1]);
+	const double Z = GetDouble(Position + PCGExNoise3D::ComponentOffsets[2]);
 	return FVector(X, Y, Z);
 }
 
 FVector4 FPCGExNoise3DOperation::GetVector4(const FVector& Position) const
 {
 	const double X = GetDouble(Position);
-	const double Y = GetDouble(Position + FVector(127.1, 311.7, 74.7));
-	const double Z = GetDouble(Position + FVector(269.5, 183.3, 246.1));
-	const double W = GetDouble(Position + FVector(419.2, 371.9, 168.2));
+	const double Y = GetDouble(Position + PCGExNoise3D::ComponentOffsets[1]);
+	const double Z = GetDouble(Position + PCGExNoise3D::ComponentOffsets[2]);
+	const double W = GetDouble(Position + PCGExNoise3D::ComponentOffsets[3]);
 	return FVector4(X, Y, Z, W);
 }
 
+void FPCGExNoise3DOperation::GenerateRawBatch(const double* RESTRICT X, const double* RESTRICT Y, const double* RESTRICT Z, double* RESTRICT OutResults, const int32 Count) const
+{
+	for (int32 i = 0; i < Count; ++i) { OutResults[i] = GenerateRaw(FVector(X[i], Y[i], Z[i])); }
+}
+
+void FPCGExNoise3DOperation::TransformBatch(const FVector* Positions, const int32 Count, double* RESTRICT X, double* RESTRICT Y, double* RESTRICT Z) const
+{
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const FVector P = TransformPosition(Positions[i]);
+		X[i] = P.X;
+		Y[i] = P.Y;
+		Z[i] = P.Z;
+	}
+}
+
+void FPCGExNoise3DOperation::GetDoubleBatch(const FVector* Positions, double* OutResults, const int32 Count) const
+{
+	using namespace PCGExNoise3D::Math;
+	check(Count <= BatchSize);
+
+	if (!SupportsBatch())
+	{
+		for (int32 i = 0; i < Count; ++i) { OutResults[i] = GetDouble(Positions[i]); }
+		return;
+	}
+
+	double X[BatchSize], Y[BatchSize], Z[BatchSize];
+	double SX[BatchSize], SY[BatchSize], SZ[BatchSize];
+
+	TransformBatch(Positions, Count, X, Y, Z);
+
+	if (Octaves <= 1)
+	{
+		for (int32 i = 0; i < Count; ++i)
+		{
+			SX[i] = X[i] * Frequency;
+			SY[i] = Y[i] * Frequency;
+			SZ[i] = Z[i] * Frequency;
+		}
+
+		GenerateRawBatch(SX, SY, SZ, OutResults, Count);
+	}
+	else
+	{
+		ComputeFractalBounding();
+
+		double Raw[BatchSize];
+		double Sum[BatchSize];
+		for (int32 i = 0; i < Count; ++i) { Sum[i] = 0.0; }
+
+		double Amp = 1.0;
+		double Freq = Frequency;
+
+		for (int32 o = 0; o < Octaves; ++o)
+		{
+			for (int32 i = 0; i < Count; ++i)
+			{
+				SX[i] = X[i] * Freq;
+				SY[i] = Y[i] * Freq;
+				SZ[i] = Z[i] * Freq;
+			}
+
+			GenerateRawBatch(SX, SY, SZ, Raw, Count);
+			for (int32 i = 0; i < Count; ++i) { Sum[i] += Raw[i] * Amp; }
+
+			Amp *= Persistence;
+			Freq *= Lacunarity;
+		}
+
+		for (int32 i = 0; i < Count; ++i) { OutResults[i] = Sum[i] * FractalBounding; }
+	}
+
+	for (int32 i = 0; i < Count; ++i) { OutResults[i] = ApplyRemap(OutResults[i]); }
+}
+
+void FPCGExNoise3DOperation::GetComponentsBatch(const FVector* Positions, const int32 Count, const int32 NumComponents, double (*OutValues)[PCGExNoise3D::Math::BatchSize]) const
+{
+	GetDoubleBatch(Positions, OutValues[0], Count);
+
+	FVector Offset[PCGExNoise3D::Math::BatchSize];
+	for (int32 c = 1; c < NumComponents; ++c)
+	{
+		for (int32 i = 0; i < Count; ++i) { Offset[i] = Positions[i] + PCGExNoise3D::ComponentOffsets[c]; }
+		GetDoubleBatch(Offset, OutValues[c], Count);
+	}
+}
+
 void FPCGExNoise3DOperation::Generate(const TArrayView<const FVector> Positions, TArrayView<double> OutResults) const
 {
 	check(Positions.Num() == OutResults.Num());
 	const int32 Count = Positions.Num();
-	for (int32 i = 0; i < Count; ++i)
+
+	for (int32 Start = 0; Start < Count; Start += PCGExNoise3D::Math::BatchSize)
 	{
-		OutResults[i] = GetDouble(Positions[i]);
+		const int32 Num = FMath::Min(PCGExNoise3D::Math::BatchSize, Count - Start);
+		GetDoubleBatch(Positions.GetData() + Start, OutResults.GetData() + Start, Num);
 	}
 }
 
@@ -78,9 +179,19 @@ void FPCGExNoise3DOperation::Generate(const TArrayView<const FVector> Positions,
 {
 	check(Positions.Num() == OutResults.Num());
 	const int32 Count = Positions.Num();
-	for (int32 i = 0; i < Count; ++i)
+
+	if (!SupportsBatch())
+	{
+		for (int32 i = 0; i < Count; ++i) { OutResults[i] = GetVector2D(Positions[i]); }
+		return;
+	}
+
+	double Values[2][PCGExNoise3D::Math::BatchSize];
+	for (int32 Start = 0; Start < Count; Start += PCGExNoise3D::Math::BatchSize)
 	{
-		OutResults[i] = GetVector2D(Positions[i]);
+		const int32 Num = FMath::Min(PCGExNoise3D::Math::BatchSize, Count - Start);
+		GetComponentsBatch(Positions.GetData() + Start, Num, 2, Values);
+		for (int32 i = 0; i < Num; ++i) { OutResults[Start + i] = FVector2D(Values[0][i], Values[1][i]); }
 	}
 }
 
@@ -88,9 +199,19 @@ void FPCGExNoise3DOperation::Generate(const TArrayView<const FVector> Positions,
 {
 	check(Positions.Num() == OutResults.Num());
 	const int32 Count = Positions.Num();
-	for (int32 i = 0; i < Count; ++i)
+
+	if (!SupportsBatch())
+	{
+		for (int32 i = 0; i < Count; ++i) { OutResults[i] = GetVector(Positions[i]); }
+		return;
+	}
+
+	double Values[3][PCGExNoise3D::Math::BatchSize];
+	for (int32 Start = 0; Start < Count; Start += PCGExNoise3D::Math::BatchSize)
 	{
-		OutResults[i] = GetVector(Positions[i]);
+		const int32 Num = FMath::Min(PCGExNoise3D::Math::BatchSize, Count - Start);
+		GetComponentsBatch(Positions.GetData() + Start, Num, 3, Values);
+		for (int32 i = 0; i < Num; ++i) { OutResults[Start + i] = FVector(Values[0][i], Values[1][i], Values[2][i]); }
 	}
 }
 
@@ -98,8 +219,18 @@ void FPCGExNoise3DOperation::Generate(const TArrayView<const FVector> Positions,
 {
 	check(Positions.Num() == OutResults.Num());
 	const int32 Count = Positions.Num();
-	for (int32 i = 0; i < Count; ++i)
+
+	if (!SupportsBatch())
+	{
+		for (int32 i = 0; i < Count; ++i) { OutResults[i] = GetVector4(Positions[i]); }
+		return;
+	}
+
+	double Values[4][PCGExNoise3D::Math::BatchSize];
+	for (int32 Start = 0; Start < Count; Start += PCGExNoise3D::Math::BatchSize)
 	{
-		OutResults[i] = GetVector4(Positions[i]);
+		const int32 Num = FMath::Min(PCGExNoise3D::Math::BatchSize, Count - Start);
+		GetComponentsBatch(Positions.GetData() + Start, Num, 4, Values);
+		for (int32 i = 0; i < Num; ++i) { OutResults[Start + i] = FVector4(Values[0][i], Values[1][i], Values[2][i], Values[3][i]); }
 	}
 }
@@ -210,6 +210,125 @@ double FPCGExNoiseFBM::GetDouble(const FVector& Position) const
 	return ApplyRemap(Value);
 }
 
+void FPCGExNoiseFBM::GetDoubleBatch(const FVector* Positions, double* OutResults, const int32 Count) const
+{
+	check(Count <= BatchSize);
+
+	// Warp layers feed back into the sampled positions, keep it per-point
+	if (Variant == EPCGExFBMVariant::Warped)
+	{
+		for (int32 i = 0; i < Count; ++i) { OutResults[i] = GetDouble(Positions[i]); }
+		return;
+	}
+
+	double X[BatchSize], Y[BatchSize], Z[BatchSize];
+	double SX[BatchSize], SY[BatchSize], SZ[BatchSize];
+	double Noise[BatchSize], Sum[BatchSize], Weight[BatchSize];
+
+	TransformBatch(Positions, Count, X, Y, Z);
+
+	double Amp = 1.0;
+	double Freq = Frequency;
+
+	// One octave of base noise for the whole chunk
+	auto SampleOctave = [&]()
+	{
+		for (int32 i = 0; i < Count; ++i)
+		{
+			SX[i] = X[i] * Freq;
+			SY[i] = Y[i] * Freq;
+			SZ[i] = Z[i] * Freq;
+		}
+
+		PerlinBatch(SX, SY, SZ, Noise, Count, Seed);
+	};
+
+	for (int32 i = 0; i < Count; ++i)
+	{
+		Sum[i] = 0.0;
+		Weight[i] = 1.0;
+	}
+
+	switch (Variant)
+	{
+	case EPCGExFBMVariant::Ridged:
+		for (int32 o = 0; o < Octaves; ++o)
+		{
+			SampleOctave();
+			for (int32 i = 0; i < Count; ++i)
+			{
+				double N = RidgeOffset - FMath::Abs(Noise[i]);
+				N = N * N;
+				N *= Weight[i];
+				Weight[i] = FMath::Clamp(N * 2.0, 0.0, 1.0);
+				Sum[i] += N * Amp;
+			}
+			Amp *= Persistence;
+			Freq *= Lacunarity;
+		}
+		for (int32 i = 0; i < Count; ++i) { OutResults[i] = Sum[i] * 1.25 - 1.0; }
+		break;
+
+	case EPCGExFBMVariant::Billow:
+		{
+			const double Bounding = CalcFractalBounding(Octaves, Persistence);
+			for (int32 o = 0; o < Octaves; ++o)
+			{
+				SampleOctave();
+				for (int32 i = 0; i < Count; ++i) { Sum[i] += (FMath::Abs(Noise[i]) * 2.0 - 1.0) * Amp; }
+				Amp *= Persistence;
+				Freq *= Lacunarity;
+			}
+			for (int32 i = 0; i < Count; ++i) { OutResults[i] = Sum[i] * Bounding; }
+		}
+		break;
+
+	case EPCGExFBMVariant::Hybrid:
+		SampleOctave();
+		for (int32 i = 0; i < Count; ++i)
+		{
+			const double N = (Noise[i] + RidgeOffset) * Amp;
+			Sum[i] = N;
+			Weight[i] = N;
+		}
+		Amp *= Persistence;
+		Freq *= Lacunarity;
+
+		for (int32 o = 1; o < Octaves; ++o)
+		{
+			SampleOctave();
+			for (int32 i = 0; i < Count; ++i)
+			{
+				Weight[i] = FMath::Clamp(Weight[i], 0.0, 1.0);
+				const double N = (Noise[i] + RidgeOffset) * Amp * Weight[i];
+				Sum[i] += N;
+				Weight[i] *= 2.0 * N;
+			}
+			Amp *= Persistence;
+			Freq *= Lacunarity;
+		}
+		for (int32 i = 0; i < Count; ++i) { OutResults[i] = Sum[i] * 0.5 - 1.0; }
+		break;
+
+	case EPCGExFBMVariant::Standard:
+	default:
+		{
+			const double Bounding = CalcFractalBounding(Octaves, Persistence);
+			for (int32 o = 0; o < Octaves; ++o)
+			{
+				SampleOctave();
+				for (int32 i = 0; i < Count; ++i) { Sum[i] += Noise[i] * Amp; }
+				Amp *= Persistence;
+				Freq *= Lacunarity;
+			}
+			for (int32 i = 0; i < Count; ++i) { OutResults[i] = Sum[i] * Bounding; }
+		}
+		break;
+	}
+
+	for (int32 i = 0; i < Count; ++i) { OutResults[i] = ApplyRemap(OutResults[i]); }
+}
+
 TSharedPtr<FPCGExNoise3DOperation> UPCGExNoise3DFactoryFBM::CreateOperation(FPCGExContext* InContext) const
 {
 	PCGEX_FACTORY_NEW_OPERATION(NoiseFBM)
@@ -26,35 +26,76 @@ double FPCGExNoiseOpenSimplex2::GenerateRaw(const FVector& Position) const
 
 	// Unskew
 	const double SQ = (XSI + YSI + ZSI) * STRETCH_3D;
-	double DX0 = XSI + SQ;
-	double DY0 = YSI + SQ;
-	double DZ0 = ZSI + SQ;
+	const double DX0 = XSI + SQ;
+	const double DY0 = YSI + SQ;
+	const double DZ0 = ZSI + SQ;
+
+	return EvalCell(XSB, YSB, ZSB, DX0, DY0, DZ0);
+}
+
+void FPCGExNoiseOpenSimplex2::GenerateRawBatch(const double* RESTRICT X, const double* RESTRICT Y, const double* RESTRICT Z, double* RESTRICT OutResults, const int32 Count) const
+{
+	check(Count <= BatchSize);
+
+	int32 CX[BatchSize], CY[BatchSize], CZ[BatchSize];
+	double DX[BatchSize], DY[BatchSize], DZ[BatchSize];
+
+	// Skew, floor & unskew, arithmetic only
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const double S = (X[i] + Y[i] + Z[i]) * SQUISH_3D;
+		const double XS = X[i] + S;
+		const double YS = Y[i] + S;
+		const double ZS = Z[i] + S;
+
+		CX[i] = FastFloor(XS);
+		CY[i] = FastFloor(YS);
+		CZ[i] = FastFloor(ZS);
+
+		const double XSI = XS - CX[i];
+		const double YSI = YS - CY[i];
+		const double ZSI = ZS - CZ[i];
+
+		const double SQ = (XSI + YSI + ZSI) * STRETCH_3D;
+		DX[i] = XSI + SQ;
+		DY[i] = YSI + SQ;
+		DZ[i] = ZSI + SQ;
+	}
+
+	for (int32 i = 0; i < Count; ++i) { OutResults[i] = EvalCell(CX[i], CY[i], CZ[i], DX[i], DY[i], DZ[i]); }
+}
+
+double FPCGExNoiseOpenSimplex2::EvalCell(const int32 XSB, const int32 YSB, const int32 ZSB, const double DX0, const double DY0, const double DZ0) const
+{
+	// All 8 corners of the skewed cube contribute, hash them together
+	int32 H[8];
+	HashCube(XSB + Seed, YSB, ZSB, H);
 
 	double Value = 0.0;
 
 	// Contribution from (0,0,0)
-	Value += Contrib(XSB, YSB, ZSB, DX0, DY0, DZ0);
+	Value += Contrib(H[0], DX0, DY0, DZ0);
 
 	// Contribution from (1,0,0)
-	Value += Contrib(XSB + 1, YSB, ZSB, DX0 - 1 - STRETCH_3D, DY0 - STRETCH_3D, DZ0 - STRETCH_3D);
+	Value += Contrib(H[1], DX0 - 1 - STRETCH_3D, DY0 - STRETCH_3D, DZ0 - STRETCH_3D);
 
 	// Contribution from (0,1,0)
-	Value += Contrib(XSB, YSB + 1, ZSB, DX0 - STRETCH_3D, DY0 - 1 - STRETCH_3D, DZ0 - STRETCH_3D);
+	Value += Contrib(H[2], DX0 - STRETCH_3D, DY0 - 1 - STRETCH_3D, DZ0 - STRETCH_3D);
 
 	// Contribution from (0,0,1)
-	Value += Contrib(XSB, YSB, ZSB + 1, DX0 - STRETCH_3D, DY0 - STRETCH_3D, DZ0 - 1 - STRETCH_3D);
+	Value += Contrib(H[4], DX0 - STRETCH_3D, DY0 - STRETCH_3D, DZ0 - 1 - STRETCH_3D);
 
 	// Contribution from (1,1,0)
-	Value += Contrib(XSB + 1, YSB + 1, ZSB, DX0 - 1 - 2 * STRETCH_3D, DY0 - 1 - 2 * STRETCH_3D, DZ0 - 2 * STRETCH_3D);
+	Value += Contrib(H[3], DX0 - 1 - 2 * STRETCH_3D, DY0 - 1 - 2 * STRETCH_3D, DZ0 - 2 * STRETCH_3D);
 
 	// Contribution from (1,0,1)
-	Value += Contrib(XSB + 1, YSB, ZSB + 1, DX0 - 1 - 2 * STRETCH_3D, DY0 - 2 * STRETCH_3D, DZ0 - 1 - 2 * STRETCH_3D);
+	Value += Contrib(H[5], DX0 - 1 - 2 * STRETCH_3D, DY0 - 2 * STRETCH_3D, DZ0 - 1 - 2 * STRETCH_3D);
 
 	// Contribution from (0,1,1)
-	Value += Contrib(XSB, YSB + 1, ZSB + 1, DX0 - 2 * STRETCH_3D, DY0 - 1 - 2 * STRETCH_3D, DZ0 - 1 - 2 * STRETCH_3D);
+	Value += Contrib(H[6], DX0 - 2 * STRETCH_3D, DY0 - 1 - 2 * STRETCH_3D, DZ0 - 1 - 2 * STRETCH_3D);
 
 	// Contribution from (1,1,1)
-	Value += Contrib(XSB + 1, YSB + 1, ZSB + 1, DX0 - 1 - 3 * STRETCH_3D, DY0 - 1 - 3 * STRETCH_3D, DZ0 - 1 - 3 * STRETCH_3D);
+	Value += Contrib(H[7], DX0 - 1 - 3 * STRETCH_3D, DY0 - 1 - 3 * STRETCH_3D, DZ0 - 1 - 3 * STRETCH_3D);
 
 	return Value / NORM_3D;
 }
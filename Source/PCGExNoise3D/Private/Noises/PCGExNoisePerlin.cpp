@@ -61,6 +61,11 @@ double FPCGExNoisePerlin::GenerateRaw(const FVector& Position) const
 	return Lerp(XY0, XY1, W);
 }
 
+void FPCGExNoisePerlin::GenerateRawBatch(const double* RESTRICT X, const double* RESTRICT Y, const double* RESTRICT Z, double* RESTRICT OutResults, const int32 Count) const
+{
+	PerlinBatch(X, Y, Z, OutResults, Count, Seed);
+}
+
 TSharedPtr<FPCGExNoise3DOperation> UPCGExNoise3DFactoryPerlin::CreateOperation(FPCGExContext* InContext) const
 {
 	PCGEX_FACTORY_NEW_OPERATION(NoisePerlin)
@@ -21,6 +21,35 @@ double FPCGExNoiseSimplex::GenerateRaw(const FVector& Position) const
 	const double Y0 = Position.Y - (J - T);
 	const double Z0 = Position.Z - (K - T);
 
+	return EvalCell(I, J, K, X0, Y0, Z0);
+}
+
+void FPCGExNoiseSimplex::GenerateRawBatch(const double* RESTRICT X, const double* RESTRICT Y, const double* RESTRICT Z, double* RESTRICT OutResults, const int32 Count) const
+{
+	check(Count <= BatchSize);
+
+	int32 CI[BatchSize], CJ[BatchSize], CK[BatchSize];
+	double DX[BatchSize], DY[BatchSize], DZ[BatchSize];
+
+	// Skew & cell origin, arithmetic only
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const double S = (X[i] + Y[i] + Z[i]) * F3;
+		CI[i] = FastFloor(X[i] + S);
+		CJ[i] = FastFloor(Y[i] + S);
+		CK[i] = FastFloor(Z[i] + S);
+
+		const double T = (CI[i] + CJ[i] + CK[i]) * G3;
+		DX[i] = X[i] - (CI[i] - T);
+		DY[i] = Y[i] - (CJ[i] - T);
+		DZ[i] = Z[i] - (CK[i] - T);
+	}
+
+	for (int32 i = 0; i < Count; ++i) { OutResults[i] = EvalCell(CI[i], CJ[i], CK[i], DX[i], DY[i], DZ[i]); }
+}
+
+double FPCGExNoiseSimplex::EvalCell(const int32 I, const int32 J, const int32 K, const double X0, const double Y0, const double Z0) const
+{
 	// Determine which simplex we're in
 	int32 I1, J1, K1; // Offsets for second corner
 	int32 I2, J2, K2; // Offsets for third corner
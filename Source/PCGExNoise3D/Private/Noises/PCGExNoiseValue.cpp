@@ -45,6 +45,32 @@ double FPCGExNoiseValue::GenerateRaw(const FVector& Position) const
 	return Lerp(XY0, XY1, W);
 }
 
+void FPCGExNoiseValue::GenerateRawBatch(const double* RESTRICT X, const double* RESTRICT Y, const double* RESTRICT Z, double* RESTRICT OutResults, const int32 Count) const
+{
+	check(Count <= BatchSize);
+
+	int32 CX[BatchSize], CY[BatchSize], CZ[BatchSize];
+	double FX[BatchSize], FY[BatchSize], FZ[BatchSize];
+	LatticeBatch(X, Y, Z, CX, CY, CZ, FX, FY, FZ, Count);
+
+	int32 H[8];
+	for (int32 i = 0; i < Count; ++i)
+	{
+		const double U = SmoothStep(FX[i]);
+		const double V = SmoothStep(FY[i]);
+		const double W = SmoothStep(FZ[i]);
+
+		HashCube((CX[i] + Seed) & 255, CY[i], CZ[i], H);
+
+		const double X00 = Lerp(HashToDouble(static_cast<uint8>(H[0])), HashToDouble(static_cast<uint8>(H[1])), U);
+		const double X10 = Lerp(HashToDouble(static_cast<uint8>(H[2])), HashToDouble(static_cast<uint8>(H[3])), U);
+		const double X01 = Lerp(HashToDouble(static_cast<uint8>(H[4])), HashToDouble(static_cast<uint8>(H[5])), U);
+		const double X11 = Lerp(HashToDouble(static_cast<uint8>(H[6])), HashToDouble(static_cast<uint8>(H[7])), U);
+
+		OutResults[i] = Lerp(Lerp(X00, X10, V), Lerp(X01, X11, V), W);
+	}
+}
+
 TSharedPtr<FPCGExNoise3DOperation> UPCGExNoise3DFactoryValue::CreateOperation(FPCGExContext* InContext) const
 {
 	PCGEX_FACTORY_NEW_OPERATION(NoiseValue)
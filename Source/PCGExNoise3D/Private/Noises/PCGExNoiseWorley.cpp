@@ -46,6 +46,98 @@ double FPCGExNoiseWorley::GenerateRaw(const FVector& Position) const
 		}
 	}
 
+	return FinalizeDistances(WF1, WF2, CellVal);
+}
+
+namespace PCGExWorley
+{
+	template <EPCGExWorleyDistanceFunc Func>
+	FORCEINLINE double Distance(const double DX, const double DY, const double DZ)
+	{
+		if constexpr (Func == EPCGExWorleyDistanceFunc::EuclideanSq) { return DX * DX + DY * DY + DZ * DZ; }
+		else if constexpr (Func == EPCGExWorleyDistanceFunc::Manhattan) { return FMath::Abs(DX) + FMath::Abs(DY) + FMath::Abs(DZ); }
+		else if constexpr (Func == EPCGExWorleyDistanceFunc::Chebyshev) { return FMath::Max3(FMath::Abs(DX), FMath::Abs(DY), FMath::Abs(DZ)); }
+		else { return FMath::Sqrt(DX * DX + DY * DY + DZ * DZ); }
+	}
+
+	// Walks the 3x3x3 neighborhood one neighbor at a time across the whole chunk.
+	// Each step is integer hashing + arithmetic with branchless F1/F2 updates, no cross-lane dependency.
+	template <EPCGExWorleyDistanceFunc Func>
+	void SearchBatch(
+		const double* RESTRICT X, const double* RESTRICT Y, const double* RESTRICT Z,
+		double* RESTRICT F1, double* RESTRICT F2, double* RESTRICT CellVal,
+		const int32 Count, const double Jitter, const int32 Seed)
+	{
+		int32 CX[BatchSize], CY[BatchSize], CZ[BatchSize];
+
+		for (int32 i = 0; i < Count; ++i)
+		{
+			CX[i] = FastFloor(X[i]);
+			CY[i] = FastFloor(Y[i]);
+			CZ[i] = FastFloor(Z[i]);
+			F1[i] = TNumericLimits<double>::Max();
+			F2[i] = TNumericLimits<double>::Max();
+			CellVal[i] = 0.0;
+		}
+
+		for (int32 DZ = -1; DZ <= 1; ++DZ)
+		{
+			for (int32 DY = -1; DY <= 1; ++DY)
+			{
+				for (int32 DX = -1; DX <= 1; ++DX)
+				{
+					for (int32 i = 0; i < Count; ++i)
+					{
+						const int32 NX = CX[i] + DX;
+						const int32 NY = CY[i] + DY;
+						const int32 NZ = CZ[i] + DZ;
+
+						// Same feature point as GetCellPoint; its X hash doubles as the cell value hash
+						const uint32 H = Hash32(NX + Seed, NY, NZ);
+						const double PX = NX + 0.5 + (Hash32ToDouble01(H) - 0.5) * Jitter;
+						const double PY = NY + 0.5 + (Hash32ToDouble01(Hash32(NX, NY + Seed, NZ)) - 0.5) * Jitter;
+						const double PZ = NZ + 0.5 + (Hash32ToDouble01(Hash32(NX, NY, NZ + Seed)) - 0.5) * Jitter;
+
+						const double Dist = Distance<Func>(PX - X[i], PY - Y[i], PZ - Z[i]);
+
+						const bool bNewF1 = Dist < F1[i];
+						F2[i] = bNewF1 ? F1[i] : FMath::Min(F2[i], Dist);
+						CellVal[i] = bNewF1 ? Hash32ToDouble01(H) : CellVal[i];
+						F1[i] = bNewF1 ? Dist : F1[i];
+					}
+				}
+			}
+		}
+	}
+}
+
+void FPCGExNoiseWorley::GenerateRawBatch(const double* RESTRICT X, const double* RESTRICT Y, const double* RESTRICT Z, double* RESTRICT OutResults, const int32 Count) const
+{
+	check(Count <= BatchSize);
+
+	double F1[BatchSize], F2[BatchSize], CellVal[BatchSize];
+
+	switch (DistanceFunction)
+	{
+	case EPCGExWorleyDistanceFunc::EuclideanSq:
+		PCGExWorley::SearchBatch<EPCGExWorleyDistanceFunc::EuclideanSq>(X, Y, Z, F1, F2, CellVal, Count, Jitter, Seed);
+		break;
+	case EPCGExWorleyDistanceFunc::Manhattan:
+		PCGExWorley::SearchBatch<EPCGExWorleyDistanceFunc::Manhattan>(X, Y, Z, F1, F2, CellVal, Count, Jitter, Seed);
+		break;
+	case EPCGExWorleyDistanceFunc::Chebyshev:
+		PCGExWorley::SearchBatch<EPCGExWorleyDistanceFunc::Chebyshev>(X, Y, Z, F1, F2, CellVal, Count, Jitter, Seed);
+		break;
+	default:
+		PCGExWorley::SearchBatch<EPCGExWorleyDistanceFunc::Euclidean>(X, Y, Z, F1, F2, CellVal, Count, Jitter, Seed);
+		break;
+	}
+
+	for (int32 i = 0; i < Count; ++i) { OutResults[i] = FinalizeDistances(F1[i], F2[i], CellVal[i]); }
+}
+
+double FPCGExNoiseWorley::FinalizeDistances(const double F1, const double F2, const double CellVal) const
+{
 	// Normalize distances (approximate for different distance functions)
 	double MaxDist = 1.0;
 	if (DistanceFunction == EPCGExWorleyDistanceFunc::EuclideanSq)
@@ -57,8 +149,8 @@ double FPCGExNoiseWorley::GenerateRaw(const FVector& Position) const
 		MaxDist = 3.0;
 	}
 
-	WF1 = FMath::Min(WF1 / MaxDist, 1.0);
-	WF2 = FMath::Min(WF2 / MaxDist, 1.0);
+	const double WF1 = FMath::Min(F1 / MaxDist, 1.0);
+	const double WF2 = FMath::Min(F2 / MaxDist, 1.0);
 
 	double Result;
 	switch (ReturnType)
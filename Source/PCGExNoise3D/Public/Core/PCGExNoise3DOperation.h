@@ -95,7 +95,7 @@ public:
 
 	/**
 	 * Generate scalar noise for multiple positions
-	 * Default implementation calls GetDouble in a loop
+	 * Processes positions in chunks through GetDoubleBatch; vector variants batch each component separately
 	 */
 	virtual void Generate(TArrayView<const FVector> Positions, TArrayView<double> OutResults) const;
 	virtual void Generate(TArrayView<const FVector> Positions, TArrayView<FVector2D> OutResults) const;
@@ -119,6 +119,27 @@ protected:
 	 */
 	virtual double GenerateRaw(const FVector& Position) const { return 0.0; }
 
+	/**
+	 * Batch equivalent of GenerateRaw over structure-of-arrays coordinates (at most Math::BatchSize entries)
+	 * Default calls GenerateRaw per position; override with a kernel that processes the whole chunk
+	 */
+	virtual void GenerateRawBatch(const double* RESTRICT X, const double* RESTRICT Y, const double* RESTRICT Z, double* RESTRICT OutResults, const int32 Count) const;
+
+	/**
+	 * Batch equivalent of GetDouble (at most Math::BatchSize positions)
+	 * Default runs the fractal loop one octave at a time over the whole chunk
+	 */
+	virtual void GetDoubleBatch(const FVector* Positions, double* OutResults, const int32 Count) const;
+
+	/** Whether GetDouble & vector getters are the stock ones and can go through the batch path */
+	virtual bool SupportsBatch() const { return true; }
+
+	/** Batch evaluate the first NumComponents offset components used by the vector getters */
+	void GetComponentsBatch(const FVector* Positions, const int32 Count, const int32 NumComponents, double (*OutValues)[PCGExNoise3D::Math::BatchSize]) const;
+
+	/** Apply TransformPosition to a chunk of positions, split into structure-of-arrays */
+	void TransformBatch(const FVector* Positions, const int32 Count, double* RESTRICT X, double* RESTRICT Y, double* RESTRICT Z) const;
+
 	/**
 	 * Apply post-processing: invert, remap curve, contrast
 	 */
@@ -23,6 +23,9 @@ namespace PCGExNoise3D
 		constexpr double F2 = 0.36602540378443864; // 0.5 * (FMath::Sqrt(3.0) - 1.0)
 		constexpr double G2 = 0.21132486540518713; // (3.0 - FMath::Sqrt(3.0)) / 6.0
 
+		// Max number of positions processed by a single batch kernel call
+		constexpr int32 BatchSize = 64;
+
 		// Permutation table (doubled to avoid modulo)
 		inline const uint8 Perm[512] = {
 			151, 160, 137, 91, 90, 15, 131, 13, 201, 95, 96, 53, 194, 233, 7, 225, 140, 36, 103, 30, 69, 142, 8, 99, 37, 240, 21, 10, 23,
@@ -103,6 +106,29 @@ namespace PCGExNoise3D
 			return Perm[(Perm[(Perm[((X + Seed) & 255)] + Y) & 255] + Z) & 255];
 		}
 
+		/**
+		 * Hashes of the 8 corners of lattice cell (X, Y, Z), sharing the X and XY permutation lookups
+		 * Corner index is x | y << 1 | z << 2; each entry matches Hash3D on that corner
+		 */
+		FORCEINLINE void HashCube(const int32 X, const int32 Y, const int32 Z, int32* RESTRICT OutHashes)
+		{
+			const int32 A = Perm[X & 255];
+			const int32 B = Perm[(X + 1) & 255];
+			const int32 AA = Perm[(A + Y) & 255];
+			const int32 AB = Perm[(A + Y + 1) & 255];
+			const int32 BA = Perm[(B + Y) & 255];
+			const int32 BB = Perm[(B + Y + 1) & 255];
+
+			OutHashes[0] = Perm[(AA + Z) & 255];
+			OutHashes[1] = Perm[(BA + Z) & 255];
+			OutHashes[2] = Perm[(AB + Z) & 255];
+			OutHashes[3] = Perm[(BB + Z) & 255];
+			OutHashes[4] = Perm[(AA + Z + 1) & 255];
+			OutHashes[5] = Perm[(BA + Z + 1) & 255];
+			OutHashes[6] = Perm[(AB + Z + 1) & 255];
+			OutHashes[7] = Perm[(BB + Z + 1) & 255];
+		}
+
 		/** High-quality 32-bit hash for white noise */
 		FORCEINLINE uint32 Hash32(int32 X, int32 Y, int32 Z)
 		{
@@ -247,6 +273,62 @@ namespace PCGExNoise3D
 			return FMath::Max3(FMath::Abs(A.X - B.X), FMath::Abs(A.Y - B.Y), FMath::Abs(A.Z - B.Z));
 		}
 
+		//
+		// Batch kernels
+		// Inputs are structure-of-arrays coordinates, at most BatchSize entries.
+		// Lattice setup runs as plain arithmetic loops the compiler can vectorize,
+		// the gather-heavy part (hashing, gradients) runs in a second pass.
+		//
+
+		/** Split coordinates into lattice cell and fractional offset */
+		FORCEINLINE void LatticeBatch(
+			const double* RESTRICT X, const double* RESTRICT Y, const double* RESTRICT Z,
+			int32* RESTRICT CX, int32* RESTRICT CY, int32* RESTRICT CZ,
+			double* RESTRICT FX, double* RESTRICT FY, double* RESTRICT FZ,
+			const int32 Count)
+		{
+			for (int32 i = 0; i < Count; ++i)
+			{
+				CX[i] = FastFloor(X[i]);
+				CY[i] = FastFloor(Y[i]);
+				CZ[i] = FastFloor(Z[i]);
+				FX[i] = X[i] - CX[i];
+				FY[i] = Y[i] - CY[i];
+				FZ[i] = Z[i] - CZ[i];
+			}
+		}
+
+		/** Batch Perlin gradient noise, matches the scalar Perlin lattice evaluation */
+		inline void PerlinBatch(const double* RESTRICT X, const double* RESTRICT Y, const double* RESTRICT Z, double* RESTRICT OutResults, const int32 Count, const int32 Seed)
+		{
+			check(Count <= BatchSize);
+
+			int32 CX[BatchSize], CY[BatchSize], CZ[BatchSize];
+			double FX[BatchSize], FY[BatchSize], FZ[BatchSize];
+			LatticeBatch(X, Y, Z, CX, CY, CZ, FX, FY, FZ, Count);
+
+			int32 H[8];
+			for (int32 i = 0; i < Count; ++i)
+			{
+				const double Xf = FX[i];
+				const double Yf = FY[i];
+				const double Zf = FZ[i];
+
+				const double U = SmoothStep(Xf);
+				const double V = SmoothStep(Yf);
+				const double W = SmoothStep(Zf);
+
+				HashCube((CX[i] + Seed) & 255, CY[i] & 255, CZ[i] & 255, H);
+
+				const double X00 = Lerp(GradDot3(H[0], Xf, Yf, Zf), GradDot3(H[1], Xf - 1.0, Yf, Zf), U);
+				const double X10 = Lerp(GradDot3(H[2], Xf, Yf - 1.0, Zf), GradDot3(H[3], Xf - 1.0, Yf - 1.0, Zf), U);
+				const double X01 = Lerp(GradDot3(H[4], Xf, Yf, Zf - 1.0), GradDot3(H[5], Xf - 1.0, Yf, Zf - 1.0), U);
+				const double X11 = Lerp(GradDot3(H[6], Xf, Yf - 1.0, Zf - 1.0), GradDot3(H[7], Xf - 1.0, Yf - 1.0, Zf - 1.0), U);
+
+				OutResults[i] = Lerp(Lerp(X00, X10, V), Lerp(X01, X11, V), W);
+			}
+		}
+
 		//
 		// Remapping
 		//
@@ -59,6 +59,9 @@ public:
 protected:
 	virtual double GenerateRaw(const FVector& Position) const override;
 
+	// Custom getters, no batch equivalent
+	virtual bool SupportsBatch() const override { return false; }
+
 private:
 	double BaseNoise(const FVector& Position) const;
 	FVector GetPotentialField(const FVector& Position) const;
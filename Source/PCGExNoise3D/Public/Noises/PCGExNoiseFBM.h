@@ -69,6 +69,7 @@ public:
 
 protected:
 	virtual double GenerateRaw(const FVector& Position) const override;
+	virtual void GetDoubleBatch(const FVector* Positions, double* OutResults, const int32 Count) const override;
 
 private:
 	double BaseNoise(const FVector& Position) const;
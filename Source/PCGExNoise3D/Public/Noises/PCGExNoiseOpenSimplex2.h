@@ -60,14 +60,19 @@ public:
 
 protected:
 	virtual double GenerateRaw(const FVector& Position) const override;
+	virtual void GenerateRawBatch(const double* RESTRICT X, const double* RESTRICT Y, const double* RESTRICT Z, double* RESTRICT OutResults, const int32 Count) const override;
 
 private:
-	FORCEINLINE double Contrib(int32 XSV, int32 YSV, int32 ZSV, double DX, double DY, double DZ) const
+	/** Evaluate noise from the skewed cell base (XSB, YSB, ZSB) and the unskewed offset to it */
+	double EvalCell(const int32 XSB, const int32 YSB, const int32 ZSB, const double DX0, const double DY0, const double DZ0) const;
+
+	/** Contribution from a corner, given its lattice hash (Hash3DSeed of the corner) */
+	FORCEINLINE double Contrib(const int32 Hash, double DX, double DY, double DZ) const
 	{
 		double Attn = 2.0 / 3.0 - DX * DX - DY * DY - DZ * DZ;
 		if (Attn <= 0) { return 0; }
 
-		const int32 GI = PCGExNoise3D::Math::Hash3DSeed(XSV, YSV, ZSV, Seed) % 24 * 3;
+		const int32 GI = Hash % 24 * 3;
 		const double GX = PCGExOpenSimplex2::Gradients3D[GI];
 		const double GY = PCGExOpenSimplex2::Gradients3D[GI + 1];
 		const double GZ = PCGExOpenSimplex2::Gradients3D[GI + 2];
@@ -40,6 +40,7 @@ public:
 
 protected:
 	virtual double GenerateRaw(const FVector& Position) const override;
+	virtual void GenerateRawBatch(const double* RESTRICT X, const double* RESTRICT Y, const double* RESTRICT Z, double* RESTRICT OutResults, const int32 Count) const override;
 };
 
 ////
@@ -44,8 +44,12 @@ public:
 
 protected:
 	virtual double GenerateRaw(const FVector& Position) const override;
+	virtual void GenerateRawBatch(const double* RESTRICT X, const double* RESTRICT Y, const double* RESTRICT Z, double* RESTRICT OutResults, const int32 Count) const override;
 
 private:
+	/** Evaluate noise from the simplex cell origin (I, J, K) and the unskewed offset to it */
+	double EvalCell(const int32 I, const int32 J, const int32 K, const double X0, const double Y0, const double Z0) const;
+
 	/** Contribution from a simplex corner */
 	FORCEINLINE double Contrib(int32 Hash, double X, double Y, double Z) const
 	{
@@ -56,6 +56,9 @@ public:
 protected:
 	virtual double GenerateRaw(const FVector& Position) const override;
 
+	// Custom getters, no batch equivalent
+	virtual bool SupportsBatch() const override { return false; }
+
 private:
 	/** Perlin noise with analytical derivatives */
 	void NoiseWithDerivatives(const FVector& Position, double& OutValue, FVector& OutDerivatives) const;
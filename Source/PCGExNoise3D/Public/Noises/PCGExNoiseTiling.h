@@ -61,6 +61,9 @@ public:
 protected:
 	virtual double GenerateRaw(const FVector& Position) const override;
 
+	// Custom getters, no batch equivalent
+	virtual bool SupportsBatch() const override { return false; }
+
 private:
 	/** Positive modulo */
 	FORCEINLINE int32 Mod(int32 X, int32 P) const
@@ -68,8 +68,12 @@ public:
 
 protected:
 	virtual double GenerateRaw(const FVector& Position) const override;
+	virtual void GenerateRawBatch(const double* RESTRICT X, const double* RESTRICT Y, const double* RESTRICT Z, double* RESTRICT OutResults, const int32 Count) const override;
 
 private:
+	/** Normalize F1/F2 and resolve the configured return type, in [-1, 1] */
+	double FinalizeDistances(const double F1, const double F2, const double CellVal) const;
+
 	FORCEINLINE double CalcDistance(const FVector& A, const FVector& B) const
 	{
 		switch (DistanceFunction)
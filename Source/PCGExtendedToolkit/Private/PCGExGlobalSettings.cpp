@@ -42,6 +42,8 @@ void UPCGExGlobalSettings::UpdateSettingsCaches() const
 	PCGEX_PUSH_SETTING(Core, bDefaultScopedAttributeGet)
 	PCGEX_PUSH_SETTING(Core, bBulkInitData)
 	PCGEX_PUSH_SETTING(Core, bUseDelaunator)
+	PCGEX_PUSH_SETTING(Core, bParallelDelaunay)
+	PCGEX_PUSH_SETTING(Core, ParallelDelaunayMinPoints)
 	PCGEX_PUSH_SETTING(Core, bAssertOnEmptyThread)
 	PCGEX_PUSH_SETTING(Core, ExecutionPolicy)
 
@@ -51,6 +53,13 @@ void UPCGExGlobalSettings::UpdateSettingsCaches() const
 	PCGEX_PUSH_SETTING(Core, bCacheClusters)
 	PCGEX_PUSH_SETTING(Core, bDefaultScopedIndexLookupBuild)
 	PCGEX_PUSH_SETTING(Core, bDefaultBuildAndCacheClusters)
+	PCGEX_PUSH_SETTING(Core, bPersistentClusterCache)
+	PCGEX_PUSH_SETTING(Core, PersistentClusterCacheMinNodes)
+	PCGEX_PUSH_SETTING(Core, PersistentClusterCacheDirectory)
+	PCGEX_PUSH_SETTING(Core, PersistentClusterCacheMaxSizeMB)
+
+	PCGEX_PUSH_SETTING(Core, bAdaptiveFilterOrdering)
+	PCGEX_PUSH_SETTING(Core, bLogAdaptiveFilterOrdering)
 
 	PCGEX_PUSH_SETTING(Core, SmallPointsSize)
 	PCGEX_PUSH_SETTING(Core, SmallClusterSize)
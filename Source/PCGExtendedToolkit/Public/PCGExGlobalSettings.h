@@ -52,6 +52,14 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster")
 	bool bUseDelaunator = true;
 
+	/** Split large Delaunay inputs into slabs that are triangulated in parallel, then stitch the seams. 2D requires Delaunator. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster")
+	bool bParallelDelaunay = false;
+
+	/** Inputs with fewer points than this are triangulated in a single pass. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(EditCondition="bParallelDelaunay", ClampMin=1000))
+	int32 ParallelDelaunayMinPoints = 200000;
+
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(ClampMin=1))
 	int32 SmallClusterSize = 512;
 
@@ -70,6 +78,26 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(EditCondition="bCacheClusters"))
 	bool bDefaultBuildAndCacheClusters = true;
 
+	/** Persist built clusters to disk, keyed by their vtx positions & edges topology, so they can be reloaded across executions instead of rebuilt. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster")
+	bool bPersistentClusterCache = false;
+
+	/** Clusters with fewer nodes than this are cheaper to rebuild than to reload, and won't be written to disk. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(EditCondition="bPersistentClusterCache", ClampMin=1))
+	int32 PersistentClusterCacheMinNodes = 4096;
+
+	/** Where persistent clusters are stored. Leave empty to use <ProjectSaved>/PCGEx/ClusterCache. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(EditCondition="bPersistentClusterCache"))
+	FString PersistentClusterCacheDirectory;
+
+	/** Size cap of the persistent cluster cache directory, in megabytes. Least recently used entries are evicted first. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(EditCondition="bPersistentClusterCache", ClampMin=1))
+	int32 PersistentClusterCacheMaxSizeMB = 2048;
+
+	/** Sample each filter cost & rejection rate on the first tested scope and reorder filter stacks so cheap, selective filters run first. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Filters")
+	bool bAdaptiveFilterOrdering = false;
+
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Points", meta=(ClampMin=1))
 	int32 SmallPointsSize = 1024;
 	bool IsSmallPointSize(const int32 InNum) const { return InNum <= SmallPointsSize; }
@@ -82,6 +110,10 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Debug")
 	bool bPersistentDebug = false;
 
+	/** If enabled, log the order picked by adaptive filter ordering for each filter stack. */
+	UPROPERTY(EditAnywhere, config, Category = "Debug", meta=(EditCondition="bAdaptiveFilterOrdering"))
+	bool bLogAdaptiveFilterOrdering = false;
+
 	/** If enabled, code will assert when attempting to schedule zero task. Requires a debugguer attached to the editor, otherwise will crash.  */
 	UPROPERTY(EditAnywhere, config, Category = "Debug")
 	bool bAssertOnEmptyThread = false;
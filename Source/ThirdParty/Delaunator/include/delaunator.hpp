@@ -517,7 +517,7 @@ std::size_t Delaunator::legalize(std::size_t a) {
                         hull_tri[e] = a;
                         break;
                     }
-                    e = hull_next[e];
+                    e = hull_prev[e];
                 } while (e != hull_start);
             }
             link(a, hbl);